@@ -0,0 +1,18 @@
+#ifndef TWEENERS_BENCHMARK_ELAPSED_SINCE_H
+#define TWEENERS_BENCHMARK_ELAPSED_SINCE_H
+
+#include <chrono>
+
+/**
+ * Get the number of nanoseconds elapsed since a given date of
+ * std::chrono::steady_clock.
+ */
+inline unsigned long long elapsed_since( std::chrono::nanoseconds start )
+{
+  const std::chrono::nanoseconds end
+    ( std::chrono::steady_clock::now().time_since_epoch() );
+
+  return ( end - start ).count();
+}
+
+#endif
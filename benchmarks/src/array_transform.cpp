@@ -0,0 +1,113 @@
+#include "benchmark_registry.hpp"
+#include "elapsed_since.hpp"
+#include "options.hpp"
+
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <chrono>
+#include <vector>
+
+/**
+ * Move the coordinates of many particles until their end, once with a slot
+ * per coordinate and once with a single slot for all of them.
+ */
+static void run_array_transform_benchmark
+( const options& options, std::size_t particle_count )
+{
+  struct particle
+  {
+    float x;
+    float y;
+  };
+
+  constexpr float duration( 100 );
+  const std::size_t update_count( duration / options.update_step + 2 );
+
+  std::vector< particle > particles( particle_count );
+  std::vector< float > from( particle_count );
+  std::vector< float > to( particle_count );
+
+  for ( std::size_t i( 0 ); i != particle_count; ++i )
+    {
+      from[ i ] = i % 13;
+      to[ i ] = i % 29;
+    }
+
+  {
+    tweeners::system system;
+
+    for ( std::size_t i( 0 ); i != particle_count; ++i )
+      tweeners::builder()
+        .range_transform
+        ( from[ i ], to[ i ], duration, particles[ i ].x,
+          &tweeners::easing::sine< float > )
+        .build( system );
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    for ( std::size_t i( 0 ); i != update_count; ++i )
+      system.update( options.update_step );
+
+    printf
+      ( "%llu # slot-per-value-%zu\n", elapsed_since( start ),
+        particle_count );
+  }
+
+  {
+    tweeners::system system;
+
+    tweeners::builder()
+      .array_transform
+      ( tweeners::span< const float >( from.data(), particle_count ),
+        tweeners::span< const float >( to.data(), particle_count ),
+        duration,
+        tweeners::strided_span< float >
+        ( &particles[ 0 ].x, particle_count, 2 ),
+        &tweeners::easing::sine< float > )
+      .build( system );
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    for ( std::size_t i( 0 ); i != update_count; ++i )
+      system.update( options.update_step );
+
+    printf
+      ( "%llu # array-strided-%zu\n", elapsed_since( start ),
+        particle_count );
+  }
+
+  {
+    std::vector< float > values( particle_count );
+    tweeners::system system;
+
+    tweeners::builder()
+      .array_transform
+      ( tweeners::span< const float >( from.data(), particle_count ),
+        tweeners::span< const float >( to.data(), particle_count ),
+        duration, tweeners::span< float >( values.data(), particle_count ),
+        &tweeners::easing::sine< float > )
+      .build( system );
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    for ( std::size_t i( 0 ); i != update_count; ++i )
+      system.update( options.update_step );
+
+    printf
+      ( "%llu # array-contiguous-%zu\n", elapsed_since( start ),
+        particle_count );
+  }
+}
+
+void array_transform_benchmark( const options& options )
+{
+  for ( std::size_t particle_count : { 1000, 10000 } )
+    run_array_transform_benchmark( options, particle_count );
+}
+
+register_benchmark( "array-transform", &array_transform_benchmark );
@@ -0,0 +1,114 @@
+#include "benchmark_registry.hpp"
+#include "elapsed_since.hpp"
+#include "options.hpp"
+
+#include "tweeners/builder.hpp"
+#include "tweeners/clip.hpp"
+#include "tweeners/clip_writer.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+/**
+ * Create many instances of a clip made of chains of tweeners, once with
+ * system::instantiate() and once with the builder.
+ */
+static void run_clip_benchmark
+( const options& options, std::size_t instance_count )
+{
+  constexpr std::uint32_t parameter_count( 10 );
+  constexpr std::uint32_t chain_length( 10 );
+
+  const std::size_t duration_count( options.durations.size() );
+  tweeners::clip_writer writer;
+
+  for ( std::uint32_t p( 0 ); p != parameter_count; ++p )
+    {
+      std::uint32_t previous( tweeners::clip_node::no_predecessor );
+
+      for ( std::uint32_t i( 0 ); i != chain_length; ++i )
+        previous =
+          writer.add_node
+          ( options.durations[ ( p + i ) % duration_count ],
+            tweeners::easing_id::linear, p, 0, 100, previous );
+    }
+
+  std::ostringstream stream;
+  writer.write( stream );
+
+  const std::string bytes( stream.str() );
+  std::vector< std::uint32_t > data( bytes.size() / sizeof( std::uint32_t ) );
+  std::memcpy( data.data(), bytes.data(), bytes.size() );
+
+  const tweeners::clip clip( data.data(), bytes.size() );
+  const tweeners::span< const tweeners::clip_node > nodes( clip.nodes() );
+
+  std::vector< float > values( instance_count * parameter_count );
+  std::vector< std::size_t > entries( values.size() );
+
+  for ( std::size_t i( 0 ); i != entries.size(); ++i )
+    entries[ i ] = i;
+
+  {
+    tweeners::system system;
+    const tweeners::output_buffer buffer
+      ( system.add_output_buffer( values.data(), values.size() ) );
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    for ( std::size_t i( 0 ); i != instance_count; ++i )
+      system.instantiate
+        ( clip,
+          tweeners::clip_bindings
+          { buffer,
+            tweeners::span< const std::size_t >
+            ( entries.data() + i * parameter_count, parameter_count ) } );
+
+    printf
+      ( "%llu # clip-instantiate-%zu\n", elapsed_since( start ),
+        instance_count );
+  }
+
+  {
+    tweeners::system system;
+    const tweeners::output_buffer buffer
+      ( system.add_output_buffer( values.data(), values.size() ) );
+    std::vector< tweeners::system::id_type > slots( nodes.size() );
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    for ( std::size_t i( 0 ); i != instance_count; ++i )
+      for ( std::size_t n( 0 ); n != nodes.size(); ++n )
+        {
+          const tweeners::clip_node& node( nodes[ n ] );
+          tweeners::builder builder;
+
+          builder.range_transform
+            ( node.from, node.to, node.duration,
+              &tweeners::easing::linear< float > )
+            .output( buffer, i * parameter_count + node.parameter );
+
+          if ( node.predecessor != tweeners::clip_node::no_predecessor )
+            builder.after( slots[ node.predecessor ] );
+
+          slots[ n ] = builder.build( system );
+        }
+
+    printf
+      ( "%llu # clip-builder-%zu\n", elapsed_since( start ), instance_count );
+  }
+}
+
+void clip_benchmark( const options& options )
+{
+  for ( std::size_t instance_count : { 100, 1000, 10000 } )
+    run_clip_benchmark( options, instance_count );
+}
+
+register_benchmark( "clip", &clip_benchmark );
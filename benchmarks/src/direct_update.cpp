@@ -0,0 +1,83 @@
+#include "benchmark_registry.hpp"
+#include "elapsed_since.hpp"
+#include "options.hpp"
+
+#include "tweeners/builder.hpp"
+#include "tweeners/easing_functors.hpp"
+#include "tweeners/system.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+/**
+ * Update many float variables until the end of their tweeners, once with a
+ * built-in easing and the variables as targets, such that the system calls the
+ * easing and assigns the variables directly, and once with the same
+ * computation hidden in an update callback and a transform lambda.
+ */
+static void run_direct_update_benchmark
+( const options& options, std::size_t slot_count )
+{
+  std::vector< float > values( slot_count );
+  const std::size_t duration_count( options.durations.size() );
+  float max_duration( 0 );
+
+  for ( float d : options.durations )
+    max_duration = std::max( max_duration, d );
+
+  const std::size_t update_count( max_duration / options.update_step + 2 );
+
+  {
+    tweeners::system system;
+
+    for ( std::size_t i( 0 ); i != slot_count; ++i )
+      tweeners::builder()
+        .range_transform
+        ( 0.f, 100.f, options.durations[ i % duration_count ], values[ i ],
+          tweeners::easing::ease_out_t< tweeners::easing::quad_t >() )
+        .build( system );
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    for ( std::size_t i( 0 ); i != update_count; ++i )
+      system.update( options.update_step );
+
+    printf
+      ( "%llu # direct-update-%zu\n", elapsed_since( start ), slot_count );
+  }
+
+  {
+    tweeners::system system;
+
+    for ( std::size_t i( 0 ); i != slot_count; ++i )
+      {
+        float& value( values[ i ] );
+
+        tweeners::builder()
+          .range_transform
+          ( 0.f, 100.f, options.durations[ i % duration_count ],
+            [ &value ]( float v ) -> void { value = v; },
+            []( float t ) -> float { return 1 - ( 1 - t ) * ( 1 - t ); } )
+          .build( system );
+      }
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    for ( std::size_t i( 0 ); i != update_count; ++i )
+      system.update( options.update_step );
+
+    printf
+      ( "%llu # callback-update-%zu\n", elapsed_since( start ), slot_count );
+  }
+}
+
+void direct_update_benchmark( const options& options )
+{
+  for ( std::size_t slot_count : { 1000, 10000, 100000 } )
+    run_direct_update_benchmark( options, slot_count );
+}
+
+register_benchmark( "direct-update", &direct_update_benchmark );
@@ -0,0 +1,156 @@
+#include "benchmark_registry.hpp"
+#include "elapsed_since.hpp"
+#include "options.hpp"
+
+#include "tweeners/cubic_bezier.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/easing_functors.hpp"
+#include "tweeners/easing_id.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+/**
+ * Evaluate an easing through a function pointer, as done by the system, for
+ * many ratios. The sum of the results is printed such that the evaluation is
+ * not optimized away.
+ */
+static void run_easing_benchmark
+( const char* name, float ( *easing )( float ),
+  const std::vector< float >& ratios )
+{
+  constexpr int passes( 10 );
+
+  float ( * volatile function )( float )( easing );
+  float sum( 0 );
+
+  const std::chrono::nanoseconds start
+    ( std::chrono::steady_clock::now().time_since_epoch() );
+
+  for ( int pass( 0 ); pass != passes; ++pass )
+    for ( float t : ratios )
+      sum += function( t );
+
+  printf( "%llu # easing-%s\n", elapsed_since( start ) / passes, name );
+  printf( "# sum is %f\n", sum );
+}
+
+/**
+ * Evaluate an easing stored in a std::function, as done by the builder, for
+ * many ratios.
+ */
+static void run_easing_function_benchmark
+( const char* name, const std::function< float( float ) >& easing,
+  const std::vector< float >& ratios )
+{
+  constexpr int passes( 10 );
+
+  float sum( 0 );
+
+  const std::chrono::nanoseconds start
+    ( std::chrono::steady_clock::now().time_since_epoch() );
+
+  for ( int pass( 0 ); pass != passes; ++pass )
+    for ( float t : ratios )
+      sum += easing( t );
+
+  printf( "%llu # easing-%s\n", elapsed_since( start ) / passes, name );
+  printf( "# sum is %f\n", sum );
+}
+
+void easing_benchmark( const options& )
+{
+  constexpr std::size_t ratio_count( 1000000 );
+
+  std::vector< float > ratios( ratio_count );
+
+  for ( std::size_t i( 0 ); i != ratio_count; ++i )
+    ratios[ i ] = float( ( i * 7919 ) % ratio_count ) / ratio_count;
+
+  for ( tweeners::easing_id id :
+          { tweeners::easing_id::sine, tweeners::easing_id::sine_in_out,
+            tweeners::easing_id::circ, tweeners::easing_id::expo,
+            tweeners::easing_id::expo_out, tweeners::easing_id::elastic,
+            tweeners::easing_id::elastic_in_out } )
+    {
+      const std::string name( tweeners::easing::name( id ) );
+
+      run_easing_benchmark
+        ( name.c_str(), tweeners::easing::function( id ), ratios );
+      run_easing_benchmark
+        ( ( name + "-tabulated" ).c_str(),
+          tweeners::easing::tabulated_function( id ), ratios );
+      run_easing_benchmark
+        ( ( name + "-fast" ).c_str(),
+          tweeners::easing::fast_function( id ), ratios );
+    }
+
+  run_easing_function_benchmark
+    ( "lambda-mirror-quint-in-out",
+      []( float t ) -> float
+      {
+        const auto quint_in_out
+          ( []( float t ) -> float
+            {
+              return tweeners::easing::ease_in_out
+                ( t, &tweeners::easing::quint< float > );
+            } );
+
+        return ( t <= 0.5f )
+          ? quint_in_out( 2 * t ) : quint_in_out( 2 - 2 * t );
+      },
+      ratios );
+  run_easing_function_benchmark
+    ( "functor-mirror-quint-in-out",
+      tweeners::easing::mirror
+      <
+        tweeners::easing::ease_in_out_t< tweeners::easing::quint_t >
+      >(),
+      ratios );
+
+  const tweeners::easing::cubic_bezier<> ease( 0.25, 0.1, 0.25, 1 );
+  float sum( 0 );
+
+  const std::chrono::nanoseconds start
+    ( std::chrono::steady_clock::now().time_since_epoch() );
+
+  for ( float t : ratios )
+    sum += ease( t );
+
+  printf( "%llu # easing-cubic-bezier\n", elapsed_since( start ) );
+  printf( "# sum is %f\n", sum );
+
+  std::vector< tweeners::easing::sampled_curve<>::point > points;
+
+  for ( int i( 0 ); i <= 32; ++i )
+    {
+      const float x( i / 32.f );
+      points.push_back( { x, x * x * ( 3 - 2 * x ) } );
+    }
+
+  run_easing_function_benchmark
+    ( "binary-search-32-points",
+      [ points ]( float t ) -> float
+      {
+        const auto it
+          ( std::upper_bound
+            ( points.begin() + 1, points.end() - 1, t,
+              []( float v, const tweeners::easing::sampled_curve<>::point& p )
+              -> bool
+              {
+                return v < p.x;
+              } ) );
+        const auto& high( *it );
+        const auto& low( *( it - 1 ) );
+
+        return low.y + ( t - low.x ) / ( high.x - low.x ) * ( high.y - low.y );
+      },
+      ratios );
+  run_easing_function_benchmark
+    ( "sampled-curve-32-points", tweeners::easing::sampled_curve<>( points ),
+      ratios );
+}
+
+register_benchmark( "easing", &easing_benchmark );
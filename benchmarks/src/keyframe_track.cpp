@@ -0,0 +1,98 @@
+#include "benchmark_registry.hpp"
+#include "elapsed_since.hpp"
+#include "options.hpp"
+
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/keyframe_track.hpp"
+#include "tweeners/system.hpp"
+
+#include <chrono>
+#include <vector>
+
+/**
+ * Play many animations of 50 keyframes until their end, once with a keyframe
+ * track per animation and once with a sequence of slots per animation.
+ */
+static void run_keyframe_track_benchmark
+( const options& options, std::size_t animation_count )
+{
+  constexpr std::size_t key_count( 50 );
+  constexpr float key_interval( 10 );
+
+  std::vector< tweeners::keyframe_track<>::key > keys;
+
+  for ( std::size_t i( 0 ); i != key_count; ++i )
+    keys.push_back
+      ( { i * key_interval, float( i % 7 ), tweeners::easing_id::linear } );
+
+  const tweeners::keyframe_track<> track( keys );
+  const std::size_t update_count
+    ( track.duration() / options.update_step + 2 );
+
+  std::vector< float > values( animation_count );
+
+  {
+    tweeners::system system;
+
+    for ( std::size_t i( 0 ); i != animation_count; ++i )
+      {
+        float& value( values[ i ] );
+
+        tweeners::builder()
+          .keyframes( track, [ &value ]( float v ) -> void { value = v; } )
+          .build( system );
+      }
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    for ( std::size_t i( 0 ); i != update_count; ++i )
+      system.update( options.update_step );
+
+    printf
+      ( "%llu # keyframe-track-%zu\n", elapsed_since( start ),
+        animation_count );
+  }
+
+  {
+    tweeners::system system;
+
+    for ( std::size_t i( 0 ); i != animation_count; ++i )
+      {
+        tweeners::system::id_type previous
+          ( tweeners::system::not_an_id );
+
+        for ( std::size_t k( 1 ); k != key_count; ++k )
+          {
+            tweeners::builder builder;
+            builder.range_transform
+              ( keys[ k - 1 ].value, keys[ k ].value, key_interval,
+                values[ i ], &tweeners::easing::linear< float > );
+
+            if ( previous != tweeners::system::not_an_id )
+              builder.after( previous );
+
+            previous = builder.build( system );
+          }
+      }
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    for ( std::size_t i( 0 ); i != update_count; ++i )
+      system.update( options.update_step );
+
+    printf
+      ( "%llu # keyframe-sequence-%zu\n", elapsed_since( start ),
+        animation_count );
+  }
+}
+
+void keyframe_track_benchmark( const options& options )
+{
+  for ( std::size_t animation_count : { 1000, 10000 } )
+    run_keyframe_track_benchmark( options, animation_count );
+}
+
+register_benchmark( "keyframe-track", &keyframe_track_benchmark );
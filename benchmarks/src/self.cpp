@@ -5,16 +5,23 @@
 #include "tweeners/easing.hpp"
 #include "tweeners/system.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <limits>
 
-void default_self_benchmark( const options& options )
+template< typename Config >
+static void run_self_benchmark
+( const options& options, std::size_t slot_count, const char* name )
 {
-  std::size_t slot_count( options.initial_slot_count );
+  using system_type = tweeners::system_base< Config >;
+  using builder_type = tweeners::builder_base< Config >;
+  using id_type = typename system_type::id_type;
 
   int running( 0 );
   int total( 0 );
   int update_count( 0 );
-  
+
   auto on_update( [ &update_count ]( float ) -> void { ++update_count; } );
   auto on_start
     ( [ &running, &total ]() -> void
@@ -23,17 +30,17 @@ void default_self_benchmark( const options& options )
         ++total;
       } );
   auto on_done( [ &running ]() -> void { --running; } );
-  
-  tweeners::system system;
+
+  system_type system;
   system.reserve( slot_count * 2, slot_count * 2, slot_count );
-  
+
   const std::size_t duration_count( options.durations.size() );
-  
-  std::vector< tweeners::system::id_type > slots( slot_count );
+
+  std::vector< id_type > slots( slot_count );
 
   for ( std::size_t i( 0 ); i != slot_count; ++i )
     slots[ i ] =
-      tweeners::builder()
+      builder_type()
       .range_transform
       ( 0, 100, options.durations[ i % duration_count ], on_update,
         &tweeners::easing::linear< float > )
@@ -41,16 +48,16 @@ void default_self_benchmark( const options& options )
       .on_done( on_done )
       .build( system );
 
-  std::vector< tweeners::system::id_type > previous_slots;
+  std::vector< id_type > previous_slots;
 
   for ( slot_count /= 2 ; slot_count != 0; slot_count /= 2 )
     {
       previous_slots.swap( slots );
       slots.resize( slot_count );
-      
+
       for ( std::size_t i( 0 ); i != slot_count; ++i )
         slots[ i ] =
-          tweeners::builder()
+          builder_type()
           .range_transform
           ( 0, 100, options.durations[ i % duration_count ], on_update,
             &tweeners::easing::linear< float > )
@@ -62,7 +69,7 @@ void default_self_benchmark( const options& options )
 
   const std::chrono::nanoseconds start
     ( std::chrono::steady_clock::now().time_since_epoch() );
-  
+
   do
     {
       system.update( options.update_step );
@@ -74,8 +81,38 @@ void default_self_benchmark( const options& options )
 
   printf( "# %d updates\n", update_count );
   printf
-    ( "%llu # self-default\n",
-      static_cast< unsigned long long >( ( end - start ).count() ) );
+    ( "%llu # %s\n",
+      static_cast< unsigned long long >( ( end - start ).count() ), name );
+}
+
+void default_self_benchmark( const options& options )
+{
+  run_self_benchmark< tweeners::config<> >
+    ( options, options.initial_slot_count, "self-default" );
+}
+
+/**
+ * Run the default benchmark with 16, 32 and 64 bits identifiers. The number of
+ * slots is bounded such that all the slots can be identified with 16 bits.
+ */
+void id_width_self_benchmark( const options& options )
+{
+  // Each level of sequence creates half as many slots than the previous, thus
+  // up to twice the initial count is created in total.
+  const std::size_t slot_count
+    ( std::min< std::size_t >
+      ( options.initial_slot_count,
+        std::numeric_limits< std::int16_t >::max() / 2 ) );
+
+  printf( "# initial count is %d.\n", static_cast< int >( slot_count ) );
+
+  run_self_benchmark< tweeners::config< float, std::int16_t > >
+    ( options, slot_count, "self-id-16" );
+  run_self_benchmark< tweeners::config< float, std::int32_t > >
+    ( options, slot_count, "self-id-32" );
+  run_self_benchmark< tweeners::config< float, std::int64_t > >
+    ( options, slot_count, "self-id-64" );
 }
 
 register_benchmark( "self-default", &default_self_benchmark );
+register_benchmark( "self-id-width", &id_width_self_benchmark );
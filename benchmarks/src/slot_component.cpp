@@ -0,0 +1,64 @@
+#include "benchmark_registry.hpp"
+#include "elapsed_since.hpp"
+#include "options.hpp"
+
+#include "tweeners/detail/slot_component.hpp"
+
+#include <chrono>
+#include <functional>
+
+/**
+ * Measure the operations of slot_component as used by the system for the
+ * start and done callbacks: most slots have no value and are read at every
+ * start or completion, while a few slots receive a value then are erased.
+ */
+void slot_component_benchmark( const options& options )
+{
+  constexpr int passes( 100 );
+  constexpr int value_ratio( 100 );
+
+  const int slot_count( options.initial_slot_count );
+  int call_count( 0 );
+
+  tweeners::detail::slot_component< std::function< void() >, int > component
+    ( []() -> void {} );
+
+  std::chrono::nanoseconds start
+    ( std::chrono::steady_clock::now().time_since_epoch() );
+
+  for ( int i( 0 ); i != slot_count; ++i )
+    component.add_one_slot_at_end();
+
+  for ( int i( 0 ); i < slot_count; i += value_ratio )
+    component.emplace( i, [ &call_count ]() -> void { ++call_count; } );
+
+  printf( "%llu # slot-component-fill\n", elapsed_since( start ) );
+
+  start = std::chrono::steady_clock::now().time_since_epoch();
+
+  for ( int pass( 0 ); pass != passes; ++pass )
+    for ( int i( 0 ); i != slot_count; ++i )
+      component[ i ]();
+
+  printf( "# %d calls\n", call_count );
+  printf( "%llu # slot-component-lookup\n", elapsed_since( start ) );
+
+  std::vector< int > to_erase;
+
+  for ( int i( 0 ); i < slot_count; i += value_ratio )
+    to_erase.push_back( i );
+
+  start = std::chrono::steady_clock::now().time_since_epoch();
+
+  for ( int pass( 0 ); pass != passes; ++pass )
+    {
+      component.erase( to_erase.begin(), to_erase.end() );
+
+      for ( int i : to_erase )
+        component.emplace( i, [ &call_count ]() -> void { ++call_count; } );
+    }
+
+  printf( "%llu # slot-component-erase-emplace\n", elapsed_since( start ) );
+}
+
+register_benchmark( "slot-component", &slot_component_benchmark );
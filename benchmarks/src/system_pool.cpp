@@ -0,0 +1,80 @@
+#include "benchmark_registry.hpp"
+#include "elapsed_since.hpp"
+#include "options.hpp"
+
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system_pool.hpp"
+
+#include <chrono>
+#include <vector>
+
+static bool is_running( tweeners::system_pool& pool, std::size_t system_count )
+{
+  for ( std::size_t i( 0 ); i != system_count; ++i )
+    if ( pool.get( i ).running_count() != 0 )
+      return true;
+
+  return false;
+}
+
+/**
+ * Update a fixed total number of slots spread over a varying number of
+ * systems, with a varying number of threads. One system in eight is eight
+ * times bigger than the others, to check the balance of the work.
+ */
+static void run_system_pool_benchmark
+( const options& options, std::size_t system_count, std::size_t thread_count )
+{
+  constexpr std::size_t big_system_period( 8 );
+  constexpr std::size_t big_system_factor( 8 );
+
+  const std::size_t weight_count
+    ( system_count
+      + ( system_count + big_system_period - 1 ) / big_system_period
+      * ( big_system_factor - 1 ) );
+  const std::size_t slots_per_weight
+    ( std::max< std::size_t >
+      ( 1, options.initial_slot_count / weight_count ) );
+  const std::size_t duration_count( options.durations.size() );
+
+  tweeners::system_pool pool( thread_count );
+
+  for ( std::size_t i( 0 ); i != system_count; ++i )
+    {
+      tweeners::system& system( pool.get( pool.emplace() ) );
+      const std::size_t slot_count
+        ( ( i % big_system_period == 0 )
+          ? slots_per_weight * big_system_factor
+          : slots_per_weight );
+
+      for ( std::size_t j( 0 ); j != slot_count; ++j )
+        tweeners::builder()
+          .range_transform
+          ( 0, 100, options.durations[ j % duration_count ],
+            []( float ) -> void {}, &tweeners::easing::linear< float > )
+          .build( system );
+    }
+
+  const std::chrono::nanoseconds start
+    ( std::chrono::steady_clock::now().time_since_epoch() );
+
+  do
+    {
+      pool.update( options.update_step );
+    }
+  while ( is_running( pool, system_count ) );
+
+  printf
+    ( "%llu # system-pool-%zu-systems-%zu-threads\n", elapsed_since( start ),
+      system_count, thread_count );
+}
+
+void system_pool_benchmark( const options& options )
+{
+  for ( std::size_t system_count : { 1, 16, 256, 4096 } )
+    for ( std::size_t thread_count : { 1, 2, 4, 8 } )
+      run_system_pool_benchmark( options, system_count, thread_count );
+}
+
+register_benchmark( "system-pool", &system_pool_benchmark );
@@ -0,0 +1,68 @@
+#include "benchmark_registry.hpp"
+#include "elapsed_since.hpp"
+#include "options.hpp"
+
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <chrono>
+
+/**
+ * Measure a rollback of a few frames, as done in network games: save the
+ * timing of the system, update it, then restore it.
+ */
+static void run_timing_snapshot_benchmark
+( const options& options, std::size_t slot_count )
+{
+  constexpr int passes( 100 );
+  constexpr int frames_per_pass( 8 );
+
+  const std::size_t duration_count( options.durations.size() );
+
+  tweeners::system system;
+  system.reserve( slot_count, 0, slot_count );
+
+  for ( std::size_t i( 0 ); i != slot_count; ++i )
+    tweeners::builder()
+      .range_transform
+      ( 0, 100, 1000 + options.durations[ i % duration_count ],
+        &tweeners::easing::linear< float > )
+      .build( system );
+
+  system.update( options.update_step );
+
+  tweeners::system::timing_snapshot snapshot;
+  unsigned long long save_duration( 0 );
+  unsigned long long restore_duration( 0 );
+
+  for ( int pass( 0 ); pass != passes; ++pass )
+    {
+      std::chrono::nanoseconds start
+        ( std::chrono::steady_clock::now().time_since_epoch() );
+
+      system.save_timing( snapshot );
+      save_duration += elapsed_since( start );
+
+      for ( int frame( 0 ); frame != frames_per_pass; ++frame )
+        system.update( options.update_step );
+
+      start = std::chrono::steady_clock::now().time_since_epoch();
+      system.restore_timing( snapshot );
+      restore_duration += elapsed_since( start );
+    }
+
+  printf
+    ( "%llu # timing-snapshot-save-%zu\n", save_duration / passes, slot_count );
+  printf
+    ( "%llu # timing-snapshot-restore-%zu\n", restore_duration / passes,
+      slot_count );
+}
+
+void timing_snapshot_benchmark( const options& options )
+{
+  for ( std::size_t slot_count : { 10000, 100000, 1000000 } )
+    run_timing_snapshot_benchmark( options, slot_count );
+}
+
+register_benchmark( "timing-snapshot", &timing_snapshot_benchmark );
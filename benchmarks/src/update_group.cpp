@@ -0,0 +1,75 @@
+#include "benchmark_registry.hpp"
+#include "elapsed_since.hpp"
+#include "options.hpp"
+
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <chrono>
+#include <vector>
+
+/**
+ * Update the same values either with one update callback per slot or with a
+ * single group callback.
+ */
+void update_group_benchmark( const options& options )
+{
+  const std::size_t slot_count( options.initial_slot_count );
+  const std::size_t duration_count( options.durations.size() );
+
+  std::vector< float > values( slot_count );
+
+  {
+    tweeners::system system;
+
+    for ( std::size_t i( 0 ); i != slot_count; ++i )
+      tweeners::builder()
+        .range_transform
+        ( 0.f, 100.f, options.durations[ i % duration_count ], values[ i ],
+          &tweeners::easing::linear< float > )
+        .build( system );
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    do
+      system.update( options.update_step );
+    while ( system.running_count() != 0 );
+
+    printf( "%llu # update-group-callbacks\n", elapsed_since( start ) );
+  }
+
+  {
+    tweeners::system system;
+
+    const tweeners::update_group group
+      ( system.register_update_group
+        ( [ &values ]
+          ( tweeners::span< const tweeners::system::group_entry > entries )
+          -> void
+          {
+            for ( const tweeners::system::group_entry& e : entries )
+              values[ e.key ] = e.value;
+          } ) );
+
+    for ( std::size_t i( 0 ); i != slot_count; ++i )
+      tweeners::builder()
+        .range_transform
+        ( 0, 100, options.durations[ i % duration_count ],
+          &tweeners::easing::linear< float > )
+        .in_group( group, i )
+        .build( system );
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    do
+      system.update( options.update_step );
+    while ( system.running_count() != 0 );
+
+    printf( "%llu # update-group-group\n", elapsed_since( start ) );
+  }
+}
+
+register_benchmark( "update-group", &update_group_benchmark );
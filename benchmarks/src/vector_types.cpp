@@ -0,0 +1,114 @@
+#include "benchmark_registry.hpp"
+#include "elapsed_since.hpp"
+#include "options.hpp"
+
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+#include "tweeners/vector_types.hpp"
+
+#include <chrono>
+#include <vector>
+
+/**
+ * Animate many colors until their end, once with a slot per channel and once
+ * with a slot per color.
+ */
+static void run_vector_types_benchmark
+( const options& options, std::size_t color_count )
+{
+  constexpr float duration( 100 );
+  const std::size_t update_count( duration / options.update_step + 2 );
+
+  const tweeners::vec4<> from{ 0, 0.25, 0.5, 1 };
+  const tweeners::vec4<> to{ 1, 0.75, 0, 0 };
+  std::vector< tweeners::vec4<> > colors( color_count );
+
+  {
+    tweeners::system system;
+
+    for ( tweeners::vec4<>& color : colors )
+      {
+        tweeners::builder()
+          .range_transform
+          ( from.x, to.x, duration, color.x,
+            &tweeners::easing::sine< float > )
+          .build( system );
+        tweeners::builder()
+          .range_transform
+          ( from.y, to.y, duration, color.y,
+            &tweeners::easing::sine< float > )
+          .build( system );
+        tweeners::builder()
+          .range_transform
+          ( from.z, to.z, duration, color.z,
+            &tweeners::easing::sine< float > )
+          .build( system );
+        tweeners::builder()
+          .range_transform
+          ( from.w, to.w, duration, color.w,
+            &tweeners::easing::sine< float > )
+          .build( system );
+      }
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    for ( std::size_t i( 0 ); i != update_count; ++i )
+      system.update( options.update_step );
+
+    printf
+      ( "%llu # slot-per-channel-%zu\n", elapsed_since( start ),
+        color_count );
+  }
+
+  {
+    tweeners::system system;
+
+    for ( tweeners::vec4<>& color : colors )
+      tweeners::builder()
+        .range_transform
+        ( from, to, duration, color, &tweeners::easing::sine< float > )
+        .build( system );
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    for ( std::size_t i( 0 ); i != update_count; ++i )
+      system.update( options.update_step );
+
+    printf
+      ( "%llu # vec4-%zu\n", elapsed_since( start ), color_count );
+  }
+
+  {
+    const tweeners::rgba8 from_rgba{ 0, 64, 128, 255 };
+    const tweeners::rgba8 to_rgba{ 255, 192, 0, 0 };
+    std::vector< tweeners::rgba8 > packed( color_count );
+    tweeners::system system;
+
+    for ( tweeners::rgba8& color : packed )
+      tweeners::builder()
+        .range_transform
+        ( from_rgba, to_rgba, duration, color,
+          &tweeners::easing::sine< float > )
+        .build( system );
+
+    const std::chrono::nanoseconds start
+      ( std::chrono::steady_clock::now().time_since_epoch() );
+
+    for ( std::size_t i( 0 ); i != update_count; ++i )
+      system.update( options.update_step );
+
+    printf
+      ( "%llu # rgba8-%zu\n", elapsed_since( start ), color_count );
+  }
+}
+
+void vector_types_benchmark( const options& options )
+{
+  for ( std::size_t color_count : { 1000, 10000 } )
+    run_vector_types_benchmark( options, color_count );
+}
+
+register_benchmark( "vector-types", &vector_types_benchmark );
@@ -1,5 +1,6 @@
 #include "tweeners/builder.hpp"
 #include "tweeners/easing.hpp"
+#include "tweeners/easing_functors.hpp"
 #include "tweeners/system.hpp"
 
 #include <SDL2/SDL.h>
@@ -86,23 +87,13 @@ private:
 };
 
 #define register_easing( function )                                     \
-  easing_function( #function, &tweeners::easing::function<> ),          \
+  easing_function( #function, tweeners::easing::function ## _t() ),     \
     easing_function                                                     \
     ( #function "_out",                                                 \
-      []( float t ) -> float                                            \
-      {                                                                 \
-        return                                                          \
-          tweeners::easing::ease_out( t, &tweeners::easing::function<> ); \
-      }                                                                 \
-      ),                                                                \
-  easing_function                                                       \
+      tweeners::easing::ease_out_t< tweeners::easing::function ## _t >() ), \
+    easing_function                                                     \
     ( #function "_in_out",                                              \
-      []( float t ) -> float                                            \
-      {                                                                 \
-        return                                                          \
-          tweeners::easing::ease_in_out( t, &tweeners::easing::function<> ); \
-      }                                                                 \
-    )
+      tweeners::easing::ease_in_out_t< tweeners::easing::function ## _t >() )
 
 easing_explorer::easing_explorer
 ( int screen_width, int screen_height, SDL_Rect& dot )
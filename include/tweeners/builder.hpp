@@ -2,12 +2,30 @@
 #define TWEENERS_BUILDER_HPP
 
 #include <tweeners/config.hpp>
+#include <tweeners/easing_functors.hpp>
+#include <tweeners/easing_id.hpp>
+#include <tweeners/keyframe_track.hpp>
+#include <tweeners/output_buffer.hpp>
+#include <tweeners/overwrite_policy.hpp>
+#include <tweeners/parameterized_easing.hpp>
+#include <tweeners/slot_names.hpp>
+#include <tweeners/span.hpp>
+#include <tweeners/update_group.hpp>
+#include <tweeners/vector_types.hpp>
+#include <tweeners/detail/array_lerp.hpp>
+#include <tweeners/detail/config_traits.hpp>
+#include <tweeners/detail/range_lerp.hpp>
+
+#include <type_traits>
 
 namespace tweeners
 {
   template< typename Config >
   class system_base;
 
+  template< typename Config >
+  class command_buffer_base;
+
   /**
    * \brief Convenience object to insert new tweeners in a tweeners::system.
    *
@@ -17,6 +35,16 @@ namespace tweeners
    * builder stores the information relative to the tweener to create and
    * ensures that the functions in tweeners::system are called in the expected
    * order to actually create the tweener.
+   *
+   * The arguments are inspected before being stored in function objects: the
+   * built-in easings, passed as functions or as function objects from
+   * tweeners/easing_functors.hpp, are stored as their easing_id, the
+   * parameterized easings are stored by value, and a float target is stored
+   * as a pointer. The system then calls these easings directly and writes the
+   * target without going through an update function.
+   *
+   * The components of the targets of type vec2, vec3, vec4 and rgba8 are
+   * interpolated together from the single ratio of the slot.
    */
   template< typename Config = config<> >
   class builder_base
@@ -25,6 +53,9 @@ namespace tweeners
     using duration_type = typename Config::duration_type;
     using id_type = typename Config::id_type;
     using float_type = typename Config::float_type;
+    using tag_type = typename detail::config_tag_type< Config >::type;
+    using easing_precision =
+      typename detail::config_easing_precision< Config >::type;
 
     template< typename Signature >
     using function_type = typename Config::template function_type< Signature >;
@@ -43,21 +74,112 @@ namespace tweeners
       Update update_callback,
       Transform transform );
 
+    template< typename Transform >
+    builder_base& range_transform
+    ( float_type from, float_type to, duration_type duration,
+      Transform transform );
+
+    template< typename Update >
+    builder_base& keyframes
+    ( const keyframe_track< float_type >& track, Update update_callback );
+
+    template< typename Transform >
+    builder_base& array_transform
+    ( float_type from, float_type to, duration_type duration,
+      strided_span< float_type > target, Transform transform );
+
+    template< typename Transform >
+    builder_base& array_transform
+    ( span< const float_type > from, span< const float_type > to,
+      duration_type duration, strided_span< float_type > target,
+      Transform transform );
+
+    builder_base& output( output_buffer buffer, std::size_t index );
+    builder_base& in_group( update_group group );
+    builder_base& in_group( update_group group, std::size_t key );
+
     builder_base& on_start( function_type< void() > callback );
     builder_base& on_done( function_type< void() > callback );
     builder_base& after( id_type slot_id );
+    builder_base& tag( tag_type t );
+    builder_base& names( slot_names n );
+    builder_base& overwrite( overwrite_policy policy );
 
     id_type build( system_base< Config >& system );
+    id_type build( command_buffer_base< Config >& commands );
+
+  private:
+    template< typename T >
+    void set_target( T from, T to, T& target, std::false_type );
+    void set_target
+    ( float_type from, float_type to, float_type& target, std::true_type );
+
+    template< typename Transform >
+    void set_transform( Transform transform );
+    void set_transform( float_type ( *transform )( float_type ) );
+    void set_transform( const parameterized_easing< float_type >& transform );
+
+    template< typename Transform >
+    void set_transform( Transform transform, std::true_type );
+    template< typename Transform >
+    void set_transform( Transform transform, std::false_type );
+
+    function_type< void( float_type ) > variable_update() const;
 
   private:
     duration_type m_duration;
     function_type< void( float_type ) > m_update;
     function_type< float_type( float_type ) > m_transform;
 
+    /** \brief The transform if m_has_easing is true, m_transform otherwise. */
+    easing_id m_easing;
+    bool m_has_easing;
+
+    /**
+     * \brief The transform if m_has_parameterized_easing is true,
+     *        m_transform otherwise.
+     */
+    parameterized_easing< float_type > m_parameterized_easing;
+    bool m_has_parameterized_easing;
+
+    /**
+     * \brief The float target of range_transform(), assigned directly by the
+     *        system instead of m_update. The values go from m_output_from to
+     *        m_output_to.
+     */
+    float_type* m_variable;
+
     function_type< void() > m_on_start;
     function_type< void() > m_on_done;
 
     id_type m_previous;
+
+    tag_type m_tag;
+    bool m_has_tag;
+
+    slot_names m_names;
+    bool m_has_names;
+
+    const void* m_target;
+    overwrite_policy m_overwrite;
+    bool m_has_overwrite;
+
+    bool m_has_output;
+    float_type m_output_from;
+    float_type m_output_to;
+    output_buffer m_output_buffer;
+
+    bool m_in_group;
+    update_group m_group;
+
+    /**
+     * \brief The entry of m_output_buffer receiving the values, or the key
+     *        passed to m_group if m_in_group is true, or not_an_index for the
+     *        identifier of the slot.
+     */
+    std::size_t m_output_index;
+
+    static constexpr std::size_t not_an_index = -1;
   };
 
   using builder = builder_base<>;
@@ -0,0 +1,51 @@
+#ifndef TWEENERS_CALLBACK_REGISTRY_HPP
+#define TWEENERS_CALLBACK_REGISTRY_HPP
+
+#include <tweeners/config.hpp>
+
+#include <string>
+#include <unordered_map>
+
+namespace tweeners
+{
+  /**
+   * \brief The functions that can be assigned to the slots loaded with
+   *        tweeners::load_system(), by name.
+   *
+   * The built-in easings do not need to be registered, see
+   * tweeners::easing_id.
+   */
+  template< typename Config = config<> >
+  class callback_registry_base
+  {
+  public:
+    using float_type = typename Config::float_type;
+
+    template< typename Signature >
+    using function_type = typename Config::template function_type< Signature >;
+
+    using update_function = function_type< void( float_type ) >;
+    using transform_function = function_type< float_type( float_type ) >;
+    using void_function = function_type< void() >;
+
+  public:
+    void add_update( const std::string& name, update_function f );
+    void add_transform( const std::string& name, transform_function f );
+    void add_callback( const std::string& name, void_function f );
+
+    const update_function* find_update( const std::string& name ) const;
+    const transform_function* find_transform( const std::string& name ) const;
+    const void_function* find_callback( const std::string& name ) const;
+
+  private:
+    std::unordered_map< std::string, update_function > m_updates;
+    std::unordered_map< std::string, transform_function > m_transforms;
+    std::unordered_map< std::string, void_function > m_callbacks;
+  };
+
+  using callback_registry = callback_registry_base<>;
+}
+
+#include <tweeners/detail/callback_registry.tpp>
+
+#endif
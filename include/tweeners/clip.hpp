@@ -0,0 +1,130 @@
+#ifndef TWEENERS_CLIP_HPP
+#define TWEENERS_CLIP_HPP
+
+#include <tweeners/output_buffer.hpp>
+#include <tweeners/span.hpp>
+#include <tweeners/system.hpp>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace tweeners
+{
+  /**
+   * \brief A tweener of a tweeners::clip, as stored in the clip file.
+   *
+   * The nodes are stored in the file as is, thus this type must keep the same
+   * layout in all versions of the format.
+   */
+  struct clip_node
+  {
+    /** \brief The duration of the tweener, in units of the duration_type. */
+    float duration;
+
+    /** \brief The value written when the tweener starts. */
+    float from;
+
+    /** \brief The value written when the tweener ends. */
+    float to;
+
+    /**
+     * \brief The index of the parameter receiving the values, resolved in
+     *        the clip_bindings passed to system_base::instantiate().
+     */
+    std::uint32_t parameter;
+
+    /**
+     * \brief The index of the node after which this one is played, or
+     *        no_predecessor if it starts with the clip. The predecessor is
+     *        always before the node in the clip.
+     */
+    std::uint32_t predecessor;
+
+    /** \brief The transform of the tweener, a tweeners::easing_id. */
+    std::uint8_t easing;
+
+    std::uint8_t padding[ 3 ];
+
+    static constexpr std::uint32_t no_predecessor = 0xffffffff;
+  };
+
+  static_assert
+    ( std::is_standard_layout< clip_node >::value
+      && ( sizeof( clip_node ) == 24 ),
+      "The layout of clip_node is part of the clip file format." );
+
+  /**
+   * \brief Where the parameters of a clip write their values, for
+   *        system_base::instantiate().
+   */
+  struct clip_bindings
+  {
+    /** \brief The buffer receiving the values of the parameters. */
+    output_buffer buffer;
+
+    /** \brief The entry of the buffer receiving each parameter. */
+    span< const std::size_t > entries;
+  };
+
+  namespace detail
+  {
+    /** \brief The beginning of a clip file, followed by the nodes. */
+    struct clip_header
+    {
+      char magic[ 4 ];
+      std::uint32_t version;
+      std::uint32_t byte_order;
+      std::uint32_t node_count;
+      std::uint32_t parameter_count;
+    };
+  }
+
+  /**
+   * \brief A graph of tweeners compiled by tweeners::clip_writer, to be
+   *        instantiated many times with system_base::instantiate().
+   *
+   * A clip loaded from a file maps the file in memory when the platform
+   * supports it, such that all the clips loaded from the same file share the
+   * same pages. Otherwise the file is read in memory. The content is validated
+   * once, when the clip is loaded.
+   */
+  class clip
+  {
+  public:
+    explicit clip( const std::string& path );
+    clip( const void* data, std::size_t size );
+    clip( clip&& that );
+    ~clip();
+
+    clip( const clip& ) = delete;
+    clip& operator=( const clip& ) = delete;
+
+    std::size_t parameter_count() const;
+    span< const clip_node > nodes() const;
+
+  private:
+    void read_file( const std::string& path );
+    void validate() const;
+    const detail::clip_header& header() const;
+
+  private:
+    /** \brief The content of the clip file. */
+    const char* m_data;
+
+    /** \brief The size of the content of the clip file, in bytes. */
+    std::size_t m_size;
+
+    /** \brief Tells if m_data is a memory mapping to release. */
+    bool m_mapped;
+
+    /** \brief The content of the file, when it is not mapped. */
+    std::vector< std::uint32_t > m_storage;
+  };
+}
+
+#include <tweeners/detail/clip.tpp>
+#include <tweeners/detail/system_clip.tpp>
+
+#endif
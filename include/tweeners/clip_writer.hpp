@@ -0,0 +1,43 @@
+#ifndef TWEENERS_CLIP_WRITER_HPP
+#define TWEENERS_CLIP_WRITER_HPP
+
+#include <tweeners/clip.hpp>
+#include <tweeners/easing_id.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace tweeners
+{
+  /**
+   * \brief Compile a graph of tweeners in the format loaded by
+   *        tweeners::clip.
+   */
+  class clip_writer
+  {
+  public:
+    clip_writer();
+
+    std::uint32_t add_node
+    ( float duration, easing_id easing, std::uint32_t parameter, float from,
+      float to );
+    std::uint32_t add_node
+    ( float duration, easing_id easing, std::uint32_t parameter, float from,
+      float to, std::uint32_t predecessor );
+
+    void write( std::ostream& stream ) const;
+    void save( const std::string& path ) const;
+
+  private:
+    std::vector< clip_node > m_nodes;
+
+    /** \brief One more than the largest parameter index of the nodes. */
+    std::uint32_t m_parameter_count;
+  };
+}
+
+#include <tweeners/detail/clip_writer.tpp>
+
+#endif
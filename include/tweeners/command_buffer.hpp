@@ -0,0 +1,138 @@
+#ifndef TWEENERS_COMMAND_BUFFER_HPP
+#define TWEENERS_COMMAND_BUFFER_HPP
+
+#include <tweeners/config.hpp>
+#include <tweeners/easing_id.hpp>
+#include <tweeners/output_buffer.hpp>
+#include <tweeners/overwrite_policy.hpp>
+#include <tweeners/parameterized_easing.hpp>
+#include <tweeners/slot_names.hpp>
+#include <tweeners/update_group.hpp>
+#include <tweeners/detail/command_queue.hpp>
+#include <tweeners/detail/config_traits.hpp>
+
+#include <vector>
+
+namespace tweeners
+{
+  template< typename Config >
+  class system_base;
+
+  /**
+   * \brief Record calls to the functions of a tweeners::system, to be applied
+   *        at the beginning of its next update.
+   *
+   * The functions of tweeners::system must be called from the thread owning
+   * the system. On the contrary, a command_buffer can be used from any thread,
+   * as long as each thread uses its own buffer. The identifiers of the slots
+   * are reserved without locking and the recorded commands are pushed to the
+   * system at once, also without locking, when submit() is called.
+   *
+   * The commands are applied at the beginning of the next call to
+   * system_base::update(), in the order in which they were submitted. An
+   * identifier returned by configure_slot() can be used in the subsequent
+   * commands of any buffer, but it is not valid for a direct call to the
+   * functions of the system until the commands are applied.
+   *
+   * An invalid command does not prevent the application of the other ones.
+   * The slot it concerns is removed if it was configured by the same
+   * submission, such that its identifier is not lost. Once all the commands
+   * are applied, the exception of the first invalid command is thrown by
+   * system_base::update(), before the slots are updated.
+   */
+  template< typename Config = config<> >
+  class command_buffer_base
+  {
+  public:
+    using duration_type = typename Config::duration_type;
+    using id_type = typename Config::id_type;
+    using float_type = typename Config::float_type;
+    using tag_type = typename detail::config_tag_type< Config >::type;
+
+    template< typename Signature >
+    using function_type = typename Config::template function_type< Signature >;
+
+    using update_function = function_type< void( float_type ) >;
+    using transform_function = function_type< float_type( float_type ) >;
+
+    using void_function = function_type< void() >;
+
+  public:
+    explicit command_buffer_base( system_base< Config >& system );
+    ~command_buffer_base();
+
+    command_buffer_base( const command_buffer_base& ) = delete;
+    command_buffer_base& operator=( const command_buffer_base& ) = delete;
+
+    id_type configure_slot
+    ( duration_type duration, update_function update,
+      transform_function transform );
+    id_type configure_slot
+    ( duration_type duration, update_function update, easing_id easing );
+    id_type configure_slot
+    ( duration_type duration, update_function update,
+      const parameterized_easing< float_type >& easing );
+
+    void start_slot( id_type slot_id );
+
+    void on_slot_start( id_type slot_id, void_function callback );
+    void on_slot_done( id_type slot_id, void_function callback );
+
+    void play_in_sequence( id_type first, id_type second );
+
+    void remove_slot( id_type slot_id );
+
+    void tag_slot( id_type slot_id, tag_type tag );
+    void set_slot_names( id_type slot_id, slot_names names );
+
+    void bind_target_and_start
+    ( id_type slot_id, const void* target, overwrite_policy policy,
+      id_type previous );
+
+    void bind_variable
+    ( id_type slot_id, float_type from, float_type to, float_type& variable );
+
+    void bind_output( id_type slot_id, float_type from, float_type to );
+    void bind_output
+    ( id_type slot_id, float_type from, float_type to, output_buffer buffer,
+      std::size_t index );
+
+    void bind_group
+    ( id_type slot_id, float_type from, float_type to, update_group group,
+      std::size_t key );
+
+    void submit();
+
+  private:
+    using batch = detail::command_batch< Config >;
+    using command_kind = typename batch::kind;
+
+  private:
+    batch& current_batch();
+    id_type take_id( batch& b );
+
+    void add_command
+    ( command_kind what, id_type slot_id, std::size_t arguments );
+
+    template< typename T >
+    void add_command
+    ( command_kind what, id_type slot_id, std::vector< T >& arguments,
+      T value );
+
+  private:
+    /** \brief The system to which the commands are submitted. */
+    system_base< Config >& m_system;
+
+    /**
+     * \brief The commands recorded since the last submission, or nullptr if
+     *        there is none.
+     */
+    batch* m_batch;
+  };
+
+  using command_buffer = command_buffer_base<>;
+}
+
+#include <tweeners/detail/command_buffer.tpp>
+
+#endif
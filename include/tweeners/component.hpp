@@ -0,0 +1,45 @@
+#ifndef TWEENERS_COMPONENT_HPP
+#define TWEENERS_COMPONENT_HPP
+
+#include <cstddef>
+
+namespace tweeners
+{
+  template< typename Config >
+  class system_base;
+
+  /**
+   * \brief Handle to a user component registered in a tweeners::system.
+   *
+   * A user component is an optional value of type T associated with the slots
+   * of the system. See system_base::register_component().
+   *
+   * The handle is valid only for the system that created it.
+   */
+  template< typename T >
+  class component
+  {
+    template< typename Config >
+    friend class system_base;
+
+  public:
+    component()
+      : m_index( -1 )
+    {
+
+    }
+
+  private:
+    explicit component( std::size_t index )
+      : m_index( index )
+    {
+
+    }
+
+  private:
+    /** \brief The index of the component in the system's storage. */
+    std::size_t m_index;
+  };
+}
+
+#endif
@@ -1,6 +1,9 @@
 #ifndef TWEENERS_CONFIG_HPP
 #define TWEENERS_CONFIG_HPP
 
+#include <tweeners/easing_id.hpp>
+
+#include <cstdint>
 #include <functional>
 
 namespace tweeners
@@ -27,15 +30,38 @@ namespace tweeners
     /**
      * \brief The type used to identify a slot/tweener.
      *
-     * It must be an integral type since it is used to index vectors.
+     * It must be an integral type since it is used to index vectors. It is
+     * also used to store the positions in the internal queues of the system,
+     * thus the maximum number of simultaneous slots in a system is
+     * std::numeric_limits< id_type >::max().
      */
-    using id_type = int;
+    using id_type = Id;
 
     /**
      * \brief The default float-like type, used to pass the interpolated values
      *        in the tweeners' update callbacks.
      */
-    using float_type = float;
+    using float_type = Float;
+
+    /**
+     * \brief The type of the keys used to group the slots, for example by
+     *        owner. See system_base::tag_slot().
+     *
+     * This type is optional in custom configurations, it defaults to
+     * std::uintptr_t. It must be hashable with std::hash.
+     */
+    using tag_type = std::uintptr_t;
+
+    /**
+     * \brief The policy used to get the easing functions from their
+     *        identifiers, when a clip is instantiated or a system is loaded.
+     *
+     * easing::precise uses the functions from tweeners/easing.hpp while
+     * easing::fast replaces the transcendental ones with polynomial
+     * approximations. This type is optional in custom configurations, it
+     * defaults to easing::precise.
+     */
+    using easing_precision = easing::precise;
 
     /**
      * \brief The type used to store a callable object with a signature S.
@@ -0,0 +1,71 @@
+#ifndef TWEENERS_COROUTINE_HPP
+#define TWEENERS_COROUTINE_HPP
+
+#if !defined( __cpp_impl_coroutine )
+  #error "tweeners/coroutine.hpp requires C++20 coroutines."
+#endif
+
+#include <tweeners/system.hpp>
+#include <tweeners/detail/slot_waiters.hpp>
+
+#include <coroutine>
+
+namespace tweeners
+{
+  /**
+   * \brief Suspend a coroutine until a slot completes, as in
+   *        co_await system.done( slot_id ).
+   *
+   * The coroutine is resumed by system_base::update(), after the done
+   * callbacks of the slots completed during the update. The result of the
+   * co_await expression is true, or false if the slot has been removed before
+   * its completion, in which case the coroutine is resumed at the beginning of
+   * the next update.
+   *
+   * The coroutine waits for the next completion of the slot, thus waiting on a
+   * slot that is never started suspends the coroutine until the slot is
+   * removed. The system must outlive the suspended coroutines; a coroutine
+   * destroyed while suspended stops waiting.
+   *
+   * Waiting costs no allocation: the awaiter, stored in the coroutine frame,
+   * is directly inserted in the list of waiters of the slot.
+   */
+  template< typename Config >
+  class slot_awaiter:
+    private detail::slot_waiter
+  {
+  public:
+    using id_type = typename Config::id_type;
+
+  public:
+    slot_awaiter( system_base< Config >& system, id_type slot_id );
+    ~slot_awaiter();
+
+    slot_awaiter( const slot_awaiter& ) = delete;
+    slot_awaiter& operator=( const slot_awaiter& ) = delete;
+
+    bool await_ready() const noexcept;
+    void await_suspend( std::coroutine_handle<> handle );
+    bool await_resume() const noexcept;
+
+  private:
+    static void resume_coroutine( detail::slot_waiter& self, bool completed );
+
+  private:
+    system_base< Config >& m_system;
+    const id_type m_slot;
+
+    /** \brief The suspended coroutine. */
+    std::coroutine_handle<> m_handle;
+
+    /** \brief Tells if the coroutine is in the waiters of m_slot. */
+    bool m_waiting;
+
+    /** \brief The result of the co_await expression. */
+    bool m_completed;
+  };
+}
+
+#include <tweeners/detail/coroutine.tpp>
+
+#endif
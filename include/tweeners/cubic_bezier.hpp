@@ -0,0 +1,46 @@
+#ifndef TWEENERS_CUBIC_BEZIER_HPP
+#define TWEENERS_CUBIC_BEZIER_HPP
+
+#include <memory>
+
+namespace tweeners
+{
+  namespace easing
+  {
+    /**
+     * \brief The curve of the CSS function cubic-bezier( x1, y1, x2, y2 ).
+     *
+     * The curve is a cubic Bézier from (0, 0) to (1, 1) with control points
+     * (x1, y1) and (x2, y2). Evaluating it for a ratio x requires to find the
+     * parameter of the curve whose abscissa is x. This parameter is
+     * precomputed for evenly spaced abscissas when the easing is created, then
+     * the evaluation interpolates the table and refines the result with a
+     * single Newton step.
+     *
+     * The easings created with the same control points share the same table,
+     * found in a process-wide cache.
+     */
+    template< typename Float = float >
+    class cubic_bezier
+    {
+    public:
+      cubic_bezier( Float x1, Float y1, Float x2, Float y2 );
+
+      Float operator()( Float t ) const;
+
+    private:
+      class table;
+
+    private:
+      static std::shared_ptr< const table >
+      find_table( Float x1, Float y1, Float x2, Float y2 );
+
+    private:
+      std::shared_ptr< const table > m_table;
+    };
+  }
+}
+
+#include <tweeners/detail/cubic_bezier.tpp>
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef TWEENERS_DETAIL_ARRAY_LERP_HPP
+#define TWEENERS_DETAIL_ARRAY_LERP_HPP
+
+#include <tweeners/span.hpp>
+
+namespace tweeners
+{
+  namespace detail
+  {
+    /**
+     * \brief The update function of a slot animating many values. It
+     *        interpolates all the values with the ratio passed by the system.
+     *
+     * The bounds are either shared by all the values or given per value. In
+     * the latter case they are not copied, thus they must outlive the slot.
+     *
+     * \sa builder_base::array_transform.
+     */
+    template< typename Float >
+    class array_lerp
+    {
+    public:
+      array_lerp( Float from, Float to, strided_span< Float > target );
+      array_lerp
+      ( span< const Float > from, span< const Float > to,
+        strided_span< Float > target );
+
+      void operator()( Float ratio ) const;
+
+    private:
+      void assign( Float value ) const;
+      void interpolate( Float ratio ) const;
+
+    private:
+      /** \brief The first values, or null if the bounds are shared. */
+      const Float* m_from;
+
+      /** \brief The last values, or null if the bounds are shared. */
+      const Float* m_to;
+
+      /** \brief The first value of all the targets, if m_from is null. */
+      Float m_shared_from;
+
+      /** \brief The distance to the last value, if m_from is null. */
+      Float m_shared_delta;
+
+      strided_span< Float > m_target;
+    };
+  }
+}
+
+#include <tweeners/detail/array_lerp.tpp>
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef TWEENERS_DETAIL_ARRAY_LERP_TPP
+#define TWEENERS_DETAIL_ARRAY_LERP_TPP
+
+#include <tweeners/contract.hpp>
+
+#include <algorithm>
+
+/**
+ * \brief Interpolate all the targets between the same two values.
+ */
+template< typename Float >
+tweeners::detail::array_lerp< Float >::array_lerp
+( Float from, Float to, strided_span< Float > target )
+  : m_from( nullptr ),
+    m_to( nullptr ),
+    m_shared_from( from ),
+    m_shared_delta( to - from ),
+    m_target( target )
+{
+
+}
+
+/**
+ * \brief Interpolate each target between its own values.
+ *
+ * \param from The first value of each target.
+ * \param to The last value of each target.
+ * \param target The values to update.
+ *
+ * The three spans must have the same size.
+ */
+template< typename Float >
+tweeners::detail::array_lerp< Float >::array_lerp
+( span< const Float > from, span< const Float > to,
+  strided_span< Float > target )
+  : m_from( from.data() ),
+    m_to( to.data() ),
+    m_shared_from(),
+    m_shared_delta(),
+    m_target( target )
+{
+  tweeners_confirm_contract
+    ( ( from.size() == target.size() ) && ( to.size() == target.size() ),
+      "array_lerp: the bounds must have the size of the target." );
+}
+
+template< typename Float >
+void tweeners::detail::array_lerp< Float >::operator()( Float ratio ) const
+{
+  if ( m_from == nullptr )
+    assign( m_shared_from + ratio * m_shared_delta );
+  else
+    interpolate( ratio );
+}
+
+/**
+ * \brief Assign the same value to all the targets.
+ */
+template< typename Float >
+void tweeners::detail::array_lerp< Float >::assign( Float value ) const
+{
+  Float* const target( m_target.data() );
+  const std::size_t count( m_target.size() );
+  const std::size_t stride( m_target.stride() );
+
+  if ( stride == 1 )
+    std::fill( target, target + count, value );
+  else
+    for ( std::size_t i( 0 ); i != count; ++i )
+      target[ i * stride ] = value;
+}
+
+/**
+ * \brief Assign to each target its value for a given ratio.
+ *
+ * The contiguous targets are processed in a loop of their own, which the
+ * compiler turns into vector instructions.
+ */
+template< typename Float >
+void tweeners::detail::array_lerp< Float >::interpolate( Float ratio ) const
+{
+  const Float* const from( m_from );
+  const Float* const to( m_to );
+  Float* const target( m_target.data() );
+  const std::size_t count( m_target.size() );
+  const std::size_t stride( m_target.stride() );
+
+  if ( stride == 1 )
+    for ( std::size_t i( 0 ); i != count; ++i )
+      target[ i ] = from[ i ] + ratio * ( to[ i ] - from[ i ] );
+  else
+    for ( std::size_t i( 0 ); i != count; ++i )
+      target[ i * stride ] = from[ i ] + ratio * ( to[ i ] - from[ i ] );
+}
+
+#endif
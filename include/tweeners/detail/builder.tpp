@@ -1,12 +1,29 @@
 #ifndef TWEENERS_BUILDER_TPP
 #define TWEENERS_BUILDER_TPP
 
+#include <tweeners/command_buffer.hpp>
 #include <tweeners/contract.hpp>
+#include <tweeners/easing.hpp>
 #include <tweeners/system.hpp>
 
 template< typename Config >
 tweeners::builder_base< Config >::builder_base()
-  : m_previous( system_base< Config >::not_an_id )
+  : m_easing( easing_id::none ),
+    m_has_easing( false ),
+    m_has_parameterized_easing( false ),
+    m_variable( nullptr ),
+    m_previous( system_base< Config >::not_an_id ),
+    m_tag(),
+    m_has_tag( false ),
+    m_has_names( false ),
+    m_target( nullptr ),
+    m_overwrite( overwrite_policy::keep_both ),
+    m_has_overwrite( false ),
+    m_has_output( false ),
+    m_output_from(),
+    m_output_to(),
+    m_in_group( false ),
+    m_output_index( not_an_index )
 {
 
 }
@@ -22,6 +39,8 @@ tweeners::builder_base< Config >::builder_base()
  *
  * \param target The variable receiving the updates as the tweener
  *        progresses. Obviously the target must outlive the tweeners::system.
+ *        The conflicts with other tweeners on the same variable are resolved
+ *        if a policy is given with overwrite().
  *
  * \param transform The curve to follow to go from \p from to \p to. \sa
  * tweeners::easing.
@@ -32,14 +51,14 @@ tweeners::builder_base< Config >&
 tweeners::builder_base< Config >::range_transform
 ( T from, T to, duration_type duration, T& target, Transform transform )
 {
-  auto update
-    ( [ &target ]( T value ) -> void
-      {
-        target = value;
-      } );
+  m_duration = duration;
+  m_has_output = false;
+  set_target
+    ( from, to, target, typename std::is_same< T, float_type >::type() );
+  set_transform( std::move( transform ) );
+  m_target = &target;
 
-  // Should I std::move() the arguments or will the compiler do it for me?
-  return range_transform( from, to, duration, update, transform );
+  return *this;
 }
 
 /**
@@ -63,21 +82,215 @@ tweeners::builder_base< Config >::range_transform
 ( T from, T to, duration_type duration, Update update_callback,
   Transform transform )
 {
+  const detail::range_lerp< T, float_type > lerp( from, to );
+
   m_update =
-    [ update_callback, from, to ]( float_type ratio ) -> void
+    [ update_callback, lerp ]( float_type ratio ) -> void
     {
-      update_callback( from + ratio * ( to - from ) );
+      update_callback( lerp( ratio ) );
     };
 
   m_duration = duration;
-  m_transform = std::move( transform );
-  
-  tweeners_confirm_contract
-    ( m_transform, "tweeners::builder: The transform function is not valid." );
+  m_target = nullptr;
+  m_variable = nullptr;
+  m_has_output = false;
+  set_transform( std::move( transform ) );
   
   return *this;
 }
 
+/**
+ * \brief Configure a tweener to write its values in an output buffer of the
+ *        system, without update callback.
+ *
+ * \param from The value written when the tweener starts.
+ *
+ * \param to The value written when the tweener ends.
+ *
+ * \param duration How long it takes to iterate from \p from to \p to.
+ *
+ * \param transform The curve to follow to go from \p from to \p to. \sa
+ * tweeners::easing.
+ *
+ * The values are written in the buffer owned by the system at the index of the
+ * slot, unless another entry is given with output().
+ *
+ * \sa system_base::bind_output.
+ */
+template< typename Config >
+template< typename Transform >
+tweeners::builder_base< Config >&
+tweeners::builder_base< Config >::range_transform
+( float_type from, float_type to, duration_type duration, Transform transform )
+{
+  m_update = function_type< void( float_type ) >();
+  m_duration = duration;
+  m_target = nullptr;
+  m_variable = nullptr;
+
+  m_has_output = true;
+  m_output_from = from;
+  m_output_to = to;
+
+  set_transform( std::move( transform ) );
+
+  return *this;
+}
+
+/**
+ * \brief Configure a tweener to play a keyframe track.
+ *
+ * \param track The values to go through. It must outlive the tweener.
+ *
+ * \param update_callback The function receiving the values of the track as the
+ *        tweener progresses.
+ *
+ * The duration of the tweener is the one of the track, and the whole track is
+ * played by a single slot.
+ */
+template< typename Config >
+template< typename Update >
+tweeners::builder_base< Config >&
+tweeners::builder_base< Config >::keyframes
+( const keyframe_track< float_type >& track, Update update_callback )
+{
+  m_update =
+    detail::keyframe_cursor< float_type, Update >
+    ( track, std::move( update_callback ) );
+
+  m_duration = detail::from_float< duration_type >( track.duration() );
+  m_target = nullptr;
+  m_variable = nullptr;
+  m_has_output = false;
+  set_transform( &easing::linear< float_type > );
+
+  return *this;
+}
+
+/**
+ * \brief Configure a tweener to move many values between the same bounds.
+ *
+ * \param from The value assigned to the targets when the tweener starts.
+ *
+ * \param to The value of the targets when the tweener ends.
+ *
+ * \param duration How long it takes to iterate from \p from to \p to.
+ *
+ * \param target The values receiving the updates as the tweener progresses.
+ *        They must outlive the tweener. The first one is used as the target
+ *        of the tweener, \sa overwrite.
+ *
+ * \param transform The curve to follow to go from \p from to \p to. \sa
+ * tweeners::easing.
+ *
+ * All the values are animated by a single slot, thus the transform is
+ * evaluated once per update for all of them, and the start and done
+ * callbacks are called once.
+ */
+template< typename Config >
+template< typename Transform >
+tweeners::builder_base< Config >&
+tweeners::builder_base< Config >::array_transform
+( float_type from, float_type to, duration_type duration,
+  strided_span< float_type > target, Transform transform )
+{
+  m_update = detail::array_lerp< float_type >( from, to, target );
+  m_duration = duration;
+  m_target = target.data();
+  m_variable = nullptr;
+  m_has_output = false;
+  set_transform( std::move( transform ) );
+
+  return *this;
+}
+
+/**
+ * \brief Configure a tweener to move many values, each between its own
+ *        bounds.
+ *
+ * \param from The value assigned to each target when the tweener starts.
+ *
+ * \param to The value of each target when the tweener ends.
+ *
+ * \param duration How long it takes to iterate from \p from to \p to.
+ *
+ * \param target The values receiving the updates as the tweener progresses.
+ *
+ * \param transform The curve to follow to go from \p from to \p to. \sa
+ * tweeners::easing.
+ *
+ * The three spans must have the same size and must outlive the tweener. See
+ * the other overload for the details.
+ */
+template< typename Config >
+template< typename Transform >
+tweeners::builder_base< Config >&
+tweeners::builder_base< Config >::array_transform
+( span< const float_type > from, span< const float_type > to,
+  duration_type duration, strided_span< float_type > target,
+  Transform transform )
+{
+  m_update = detail::array_lerp< float_type >( from, to, target );
+  m_duration = duration;
+  m_target = target.data();
+  m_variable = nullptr;
+  m_has_output = false;
+  set_transform( std::move( transform ) );
+
+  return *this;
+}
+
+/**
+ * \brief Sets the entry receiving the values of a tweener configured with the
+ *        four arguments version of range_transform() (optional).
+ *
+ * \param buffer The buffer, as returned by system_base::add_output_buffer().
+ * \param index The entry of the buffer receiving the values.
+ */
+template< typename Config >
+tweeners::builder_base< Config >&
+tweeners::builder_base< Config >::output
+( output_buffer buffer, std::size_t index )
+{
+  m_output_buffer = buffer;
+  m_output_index = index;
+  m_in_group = false;
+  return *this;
+}
+
+/**
+ * \brief Pass the values of a tweener configured with the four arguments
+ *        version of range_transform() to the callback of a group, with the
+ *        identifier of the tweener as the key (optional).
+ *
+ * \sa system_base::bind_group.
+ */
+template< typename Config >
+tweeners::builder_base< Config >&
+tweeners::builder_base< Config >::in_group( update_group group )
+{
+  return in_group( group, not_an_index );
+}
+
+/**
+ * \brief Pass the values of a tweener configured with the four arguments
+ *        version of range_transform() to the callback of a group (optional).
+ *
+ * \param group The group, as returned by
+ *        system_base::register_update_group().
+ * \param key The value identifying the tweener in the callback of the group.
+ */
+template< typename Config >
+tweeners::builder_base< Config >&
+tweeners::builder_base< Config >::in_group
+( update_group group, std::size_t key )
+{
+  m_group = group;
+  m_output_index = key;
+  m_in_group = true;
+  return *this;
+}
+
 /**
  * \brief Sets the function to call when the tweener starts (optional).
  */
@@ -113,6 +326,61 @@ tweeners::builder_base< Config >::after( id_type slot_id )
   return *this;
 }
 
+/**
+ * \brief Sets the tag of the tweener, for example an identifier of its owner
+ *        (optional).
+ *
+ * \sa system_base::tag_slot.
+ */
+template< typename Config >
+tweeners::builder_base< Config >&
+tweeners::builder_base< Config >::tag( tag_type t )
+{
+  m_tag = t;
+  m_has_tag = true;
+  return *this;
+}
+
+/**
+ * \brief Sets the names under which the functions of the tweener are
+ *        registered, such that it can be saved (optional).
+ *
+ * \sa system_base::set_slot_names, tweeners::save_system.
+ */
+template< typename Config >
+tweeners::builder_base< Config >&
+tweeners::builder_base< Config >::names( slot_names n )
+{
+  m_names = std::move( n );
+  m_has_names = true;
+  return *this;
+}
+
+/**
+ * \brief Sets what to do if another tweener, not completed yet, updates the
+ *        same variable than this one (optional).
+ *
+ * The policy is considered only if the tweener was configured with a target
+ * variable in range_transform(). If the tweener is explicitly sequenced with
+ * after(), the policy overwrite_policy::queue_after behaves like
+ * overwrite_policy::keep_both.
+ *
+ * The tweener is bound to its target only if this function is called, with
+ * any policy: the tweeners built without it are not seen by the others, and
+ * they do not pay for the index of the targets, i.e. a hash map insertion
+ * when the tweener is built and a removal when it completes.
+ *
+ * \sa system_base::bind_target.
+ */
+template< typename Config >
+tweeners::builder_base< Config >&
+tweeners::builder_base< Config >::overwrite( overwrite_policy policy )
+{
+  m_overwrite = policy;
+  m_has_overwrite = true;
+  return *this;
+}
+
 /**
  * \brief Actually create a new tweener in a system.
  *
@@ -126,17 +394,45 @@ typename Config::id_type tweeners::builder_base< Config >::build
 ( system_base< Config >& system )
 {
   tweeners_confirm_contract
-    ( m_update,
+    ( m_update || m_has_output || ( m_variable != nullptr ),
       "tweeners::builder: update function is not set. Did you call"
       " range_transform()?" );
   tweeners_confirm_contract
-    ( m_transform,
+    ( m_transform || m_has_easing || m_has_parameterized_easing,
       "tweeners::builder: are you trying to insert the same tweener twice?" );
-  
-  const id_type slot
-    ( system.configure_slot
+
+  // The names are used to save the slot, which requires an update function.
+  if ( ( m_variable != nullptr ) && m_has_names )
+    {
+      m_update = variable_update();
+      m_variable = nullptr;
+    }
+
+  id_type slot;
+
+  if ( m_has_easing )
+    slot =
+      system.configure_slot
+      ( std::move( m_duration ), std::move( m_update ), m_easing );
+  else if ( m_has_parameterized_easing )
+    slot =
+      system.configure_slot
+      ( std::move( m_duration ), std::move( m_update ),
+        m_parameterized_easing );
+  else
+    slot =
+      system.configure_slot
       ( std::move( m_duration ), std::move( m_update ),
-        std::move( m_transform ) ) );
+        std::move( m_transform ) );
+
+  m_has_easing = false;
+  m_has_parameterized_easing = false;
+
+  if ( m_variable != nullptr )
+    {
+      system.bind_variable( slot, m_output_from, m_output_to, *m_variable );
+      m_variable = nullptr;
+    }
 
   if ( m_on_start )
     system.on_slot_start( slot, std::move( m_on_start ) );
@@ -144,12 +440,263 @@ typename Config::id_type tweeners::builder_base< Config >::build
   if ( m_on_done )
     system.on_slot_done( slot, std::move( m_on_done ) );
 
-  if ( m_previous == tweeners::system_base< Config >::not_an_id )
+  if ( m_has_tag )
+    system.tag_slot( slot, m_tag );
+
+  if ( m_has_names )
+    system.set_slot_names( slot, std::move( m_names ) );
+
+  if ( m_has_output )
+    {
+      const std::size_t index
+        ( ( m_output_index == not_an_index ) ? slot : m_output_index );
+
+      if ( m_in_group )
+        system.bind_group( slot, m_output_from, m_output_to, m_group, index );
+      else
+        system.bind_output
+          ( slot, m_output_from, m_output_to, m_output_buffer, index );
+    }
+
+  id_type previous( m_previous );
+
+  if ( m_has_overwrite && ( m_target != nullptr ) )
+    {
+      const id_type existing
+        ( system.bind_target( slot, m_target, m_overwrite ) );
+
+      if ( previous == system_base< Config >::not_an_id )
+        previous = existing;
+    }
+
+  if ( previous == tweeners::system_base< Config >::not_an_id )
     system.start_slot( slot );
   else
-    system.play_in_sequence( m_previous, slot );
+    system.play_in_sequence( previous, slot );
   
   return slot;
 }
 
+/**
+ * \brief Record the creation of a new tweener in a command buffer.
+ *
+ * The tweener is created in the buffer's system with the parameters passed to
+ * the other functions of the builder, during the next update of the system.
+ *
+ * \return The identifier of the tweener to be created.
+ */
+template< typename Config >
+typename Config::id_type tweeners::builder_base< Config >::build
+( command_buffer_base< Config >& commands )
+{
+  tweeners_confirm_contract
+    ( m_update || m_has_output || ( m_variable != nullptr ),
+      "tweeners::builder: update function is not set. Did you call"
+      " range_transform()?" );
+  tweeners_confirm_contract
+    ( m_transform || m_has_easing || m_has_parameterized_easing,
+      "tweeners::builder: are you trying to insert the same tweener twice?" );
+
+  // The names are used to save the slot, which requires an update function.
+  if ( ( m_variable != nullptr ) && m_has_names )
+    {
+      m_update = variable_update();
+      m_variable = nullptr;
+    }
+
+  id_type slot;
+
+  if ( m_has_easing )
+    slot =
+      commands.configure_slot
+      ( std::move( m_duration ), std::move( m_update ), m_easing );
+  else if ( m_has_parameterized_easing )
+    slot =
+      commands.configure_slot
+      ( std::move( m_duration ), std::move( m_update ),
+        m_parameterized_easing );
+  else
+    slot =
+      commands.configure_slot
+      ( std::move( m_duration ), std::move( m_update ),
+        std::move( m_transform ) );
+
+  m_has_easing = false;
+  m_has_parameterized_easing = false;
+
+  if ( m_variable != nullptr )
+    {
+      commands.bind_variable( slot, m_output_from, m_output_to, *m_variable );
+      m_variable = nullptr;
+    }
+
+  if ( m_on_start )
+    commands.on_slot_start( slot, std::move( m_on_start ) );
+
+  if ( m_on_done )
+    commands.on_slot_done( slot, std::move( m_on_done ) );
+
+  if ( m_has_tag )
+    commands.tag_slot( slot, m_tag );
+
+  if ( m_has_names )
+    commands.set_slot_names( slot, std::move( m_names ) );
+
+  if ( m_has_output )
+    {
+      const std::size_t index
+        ( ( m_output_index == not_an_index ) ? slot : m_output_index );
+
+      if ( m_in_group )
+        commands.bind_group
+          ( slot, m_output_from, m_output_to, m_group, index );
+      else
+        commands.bind_output
+          ( slot, m_output_from, m_output_to, m_output_buffer, index );
+    }
+
+  if ( m_has_overwrite && ( m_target != nullptr ) )
+    commands.bind_target_and_start( slot, m_target, m_overwrite, m_previous );
+  else if ( m_previous == tweeners::system_base< Config >::not_an_id )
+    commands.start_slot( slot );
+  else
+    commands.play_in_sequence( m_previous, slot );
+
+  return slot;
+}
+
+/**
+ * \brief Store the target of range_transform() in an update function.
+ */
+template< typename Config >
+template< typename T >
+void tweeners::builder_base< Config >::set_target
+( T from, T to, T& target, std::false_type )
+{
+  const detail::range_lerp< T, float_type > lerp( from, to );
+
+  m_variable = nullptr;
+  m_update =
+    [ &target, lerp ]( float_type ratio ) -> void
+    {
+      target = lerp( ratio );
+    };
+}
+
+/**
+ * \brief Store a float target of range_transform() for a direct assignment by
+ *        the system.
+ */
+template< typename Config >
+void tweeners::builder_base< Config >::set_target
+( float_type from, float_type to, float_type& target, std::true_type )
+{
+  m_update = function_type< void( float_type ) >();
+  m_variable = &target;
+  m_output_from = from;
+  m_output_to = to;
+}
+
+/**
+ * \brief Store the transform of the tweener, as an easing_id if it is a
+ *        function object with an identifier.
+ */
+template< typename Config >
+template< typename Transform >
+void tweeners::builder_base< Config >::set_transform( Transform transform )
+{
+  set_transform
+    ( std::move( transform ),
+      typename easing::has_easing_id< Transform >::type() );
+}
+
+/**
+ * \brief Store the transform of the tweener, as an easing_id if it is the
+ *        function of a built-in easing.
+ *
+ * The function is looked up in easing::function(), independently of the
+ * easing_precision of the configuration, which then selects the
+ * implementation of the easing.
+ */
+template< typename Config >
+void tweeners::builder_base< Config >::set_transform
+( float_type ( *transform )( float_type ) )
+{
+  tweeners_confirm_contract
+    ( transform != nullptr,
+      "tweeners::builder: The transform function is not valid." );
+
+  for ( std::size_t i( 0 ); i != easing::id_count; ++i )
+    {
+      const easing_id id( static_cast< easing_id >( i ) );
+
+      if ( easing::function< float_type >( id ) == transform )
+        {
+          m_easing = id;
+          m_has_easing = true;
+          m_has_parameterized_easing = false;
+          m_transform = function_type< float_type( float_type ) >();
+          return;
+        }
+    }
+
+  set_transform( transform, std::false_type() );
+}
+
+/**
+ * \brief Store a parameterized transform of the tweener by value.
+ */
+template< typename Config >
+void tweeners::builder_base< Config >::set_transform
+( const parameterized_easing< float_type >& transform )
+{
+  m_parameterized_easing = transform;
+  m_has_parameterized_easing = true;
+  m_has_easing = false;
+  m_transform = function_type< float_type( float_type ) >();
+}
+
+template< typename Config >
+template< typename Transform >
+void tweeners::builder_base< Config >::set_transform
+( Transform, std::true_type )
+{
+  m_easing = easing::easing_id_of< Transform >::value;
+  m_has_easing = true;
+  m_has_parameterized_easing = false;
+  m_transform = function_type< float_type( float_type ) >();
+}
+
+template< typename Config >
+template< typename Transform >
+void tweeners::builder_base< Config >::set_transform
+( Transform transform, std::false_type )
+{
+  m_transform = std::move( transform );
+  m_has_easing = false;
+  m_has_parameterized_easing = false;
+
+  tweeners_confirm_contract
+    ( m_transform, "tweeners::builder: The transform function is not valid." );
+}
+
+/**
+ * \brief Create the update function assigning the values to m_variable.
+ */
+template< typename Config >
+typename tweeners::builder_base< Config >::template function_type
+< void( typename Config::float_type ) >
+tweeners::builder_base< Config >::variable_update() const
+{
+  float_type* const variable( m_variable );
+  const float_type from( m_output_from );
+  const float_type to( m_output_to );
+
+  return
+    [ variable, from, to ]( float_type ratio ) -> void
+    {
+      *variable = from + ratio * ( to - from );
+    };
+}
+
 #endif
@@ -0,0 +1,100 @@
+#ifndef TWEENERS_DETAIL_CALLBACK_REGISTRY_TPP
+#define TWEENERS_DETAIL_CALLBACK_REGISTRY_TPP
+
+#include <tweeners/contract.hpp>
+
+namespace tweeners
+{
+  namespace detail
+  {
+    template< typename Map >
+    const typename Map::mapped_type*
+    find_registered( const Map& map, const std::string& name )
+    {
+      const auto it( map.find( name ) );
+
+      if ( it == map.end() )
+        return nullptr;
+
+      return &it->second;
+    }
+  }
+}
+
+/**
+ * \brief Register an update function. An existing function with the same name
+ *        is replaced.
+ */
+template< typename Config >
+void tweeners::callback_registry_base< Config >::add_update
+( const std::string& name, update_function f )
+{
+  tweeners_confirm_contract
+    ( f, "callback_registry::add_update(): function is not valid." );
+
+  m_updates[ name ] = std::move( f );
+}
+
+/**
+ * \brief Register a transform function. An existing function with the same
+ *        name is replaced.
+ */
+template< typename Config >
+void tweeners::callback_registry_base< Config >::add_transform
+( const std::string& name, transform_function f )
+{
+  tweeners_confirm_contract
+    ( f, "callback_registry::add_transform(): function is not valid." );
+
+  m_transforms[ name ] = std::move( f );
+}
+
+/**
+ * \brief Register a start or done callback. An existing function with the same
+ *        name is replaced.
+ */
+template< typename Config >
+void tweeners::callback_registry_base< Config >::add_callback
+( const std::string& name, void_function f )
+{
+  tweeners_confirm_contract
+    ( f, "callback_registry::add_callback(): function is not valid." );
+
+  m_callbacks[ name ] = std::move( f );
+}
+
+/**
+ * \brief Get the update function registered with a given name, or nullptr.
+ */
+template< typename Config >
+const typename tweeners::callback_registry_base< Config >::update_function*
+tweeners::callback_registry_base< Config >::find_update
+( const std::string& name ) const
+{
+  return detail::find_registered( m_updates, name );
+}
+
+/**
+ * \brief Get the transform function registered with a given name, or nullptr.
+ */
+template< typename Config >
+const typename tweeners::callback_registry_base< Config >::transform_function*
+tweeners::callback_registry_base< Config >::find_transform
+( const std::string& name ) const
+{
+  return detail::find_registered( m_transforms, name );
+}
+
+/**
+ * \brief Get the start or done callback registered with a given name, or
+ *        nullptr.
+ */
+template< typename Config >
+const typename tweeners::callback_registry_base< Config >::void_function*
+tweeners::callback_registry_base< Config >::find_callback
+( const std::string& name ) const
+{
+  return detail::find_registered( m_callbacks, name );
+}
+
+#endif
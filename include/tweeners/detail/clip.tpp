@@ -0,0 +1,202 @@
+#ifndef TWEENERS_DETAIL_CLIP_TPP
+#define TWEENERS_DETAIL_CLIP_TPP
+
+#include <tweeners/contract.hpp>
+#include <tweeners/easing_id.hpp>
+
+#include <cstring>
+#include <fstream>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+  #define tweeners_clip_has_mmap 1
+
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#else
+  #define tweeners_clip_has_mmap 0
+#endif
+
+namespace tweeners
+{
+  namespace detail
+  {
+    /** \brief The version of the clip format. */
+    constexpr std::uint32_t clip_version = 1;
+
+    /** \brief The value of clip_header::byte_order in the native order. */
+    constexpr std::uint32_t clip_byte_order = 0x01020304;
+  }
+}
+
+/**
+ * \brief Load a clip from a file written by clip_writer.
+ */
+inline tweeners::clip::clip( const std::string& path )
+  : m_data( nullptr ),
+    m_size( 0 ),
+    m_mapped( false )
+{
+#if tweeners_clip_has_mmap
+  const int fd( ::open( path.c_str(), O_RDONLY ) );
+
+  tweeners_confirm_contract( fd >= 0, "clip: cannot open the file." );
+
+  struct stat status;
+  void* mapping( MAP_FAILED );
+
+  if ( ( ::fstat( fd, &status ) == 0 ) && ( status.st_size > 0 ) )
+    {
+      m_size = status.st_size;
+      mapping = ::mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    }
+
+  ::close( fd );
+
+  if ( mapping != MAP_FAILED )
+    {
+      m_data = static_cast< const char* >( mapping );
+      m_mapped = true;
+    }
+  else
+    read_file( path );
+#else
+  read_file( path );
+#endif
+
+  try
+    {
+      validate();
+    }
+  catch( ... )
+    {
+#if tweeners_clip_has_mmap
+      if ( m_mapped )
+        ::munmap( const_cast< char* >( m_data ), m_size );
+#endif
+      throw;
+    }
+}
+
+/**
+ * \brief Use a clip stored in memory, as written by clip_writer.
+ *
+ * \param data The content of the clip, aligned like a clip_node. It is not
+ *        copied, thus it must outlive the clip.
+ * \param size The size of the content, in bytes.
+ */
+inline tweeners::clip::clip( const void* data, std::size_t size )
+  : m_data( static_cast< const char* >( data ) ),
+    m_size( size ),
+    m_mapped( false )
+{
+  tweeners_confirm_contract
+    ( reinterpret_cast< std::uintptr_t >( data ) % alignof( clip_node ) == 0,
+      "clip: the data is not aligned." );
+
+  validate();
+}
+
+inline tweeners::clip::clip( clip&& that )
+  : m_data( that.m_data ),
+    m_size( that.m_size ),
+    m_mapped( that.m_mapped ),
+    m_storage( std::move( that.m_storage ) )
+{
+  that.m_data = nullptr;
+  that.m_size = 0;
+  that.m_mapped = false;
+}
+
+inline tweeners::clip::~clip()
+{
+#if tweeners_clip_has_mmap
+  if ( m_mapped )
+    ::munmap( const_cast< char* >( m_data ), m_size );
+#endif
+}
+
+/**
+ * \brief Get the number of parameters to bind when instantiating the clip.
+ */
+inline std::size_t tweeners::clip::parameter_count() const
+{
+  return header().parameter_count;
+}
+
+/**
+ * \brief Get the tweeners of the clip.
+ */
+inline tweeners::span< const tweeners::clip_node > tweeners::clip::nodes() const
+{
+  return span< const clip_node >
+    ( reinterpret_cast< const clip_node* >
+      ( m_data + sizeof( detail::clip_header ) ),
+      header().node_count );
+}
+
+/**
+ * \brief Read the content of a file in m_storage, when it cannot be mapped.
+ */
+inline void tweeners::clip::read_file( const std::string& path )
+{
+  std::ifstream f( path, std::ios::binary | std::ios::ate );
+  tweeners_confirm_contract( f, "clip: cannot open the file." );
+
+  m_size = f.tellg();
+  m_storage.resize
+    ( ( m_size + sizeof( std::uint32_t ) - 1 ) / sizeof( std::uint32_t ) );
+
+  f.seekg( 0 );
+  f.read( reinterpret_cast< char* >( m_storage.data() ), m_size );
+  tweeners_confirm_contract( f, "clip: cannot read the file." );
+
+  m_data = reinterpret_cast< const char* >( m_storage.data() );
+}
+
+/**
+ * \brief Check that the content of the clip can be instantiated.
+ */
+inline void tweeners::clip::validate() const
+{
+  tweeners_confirm_contract
+    ( m_size >= sizeof( detail::clip_header ), "clip: the file is too short." );
+
+  const detail::clip_header& h( header() );
+
+  tweeners_confirm_contract
+    ( std::memcmp( h.magic, "TWCL", 4 ) == 0, "clip: the file is not a clip." );
+  tweeners_confirm_contract
+    ( h.version == detail::clip_version, "clip: unsupported version." );
+  tweeners_confirm_contract
+    ( h.byte_order == detail::clip_byte_order,
+      "clip: the file was written with another byte order." );
+  tweeners_confirm_contract
+    ( m_size
+      == sizeof( detail::clip_header ) + h.node_count * sizeof( clip_node ),
+      "clip: the size of the file does not match its content." );
+
+  const span< const clip_node > n( nodes() );
+
+  for ( std::size_t i( 0 ); i != n.size(); ++i )
+    {
+      tweeners_confirm_contract
+        ( n[ i ].easing < easing::id_count, "clip: unknown easing." );
+      tweeners_confirm_contract
+        ( n[ i ].parameter < h.parameter_count, "clip: unknown parameter." );
+      tweeners_confirm_contract
+        ( ( n[ i ].predecessor == clip_node::no_predecessor )
+          || ( n[ i ].predecessor < i ),
+          "clip: a node is played after a node not defined before it." );
+    }
+}
+
+inline const tweeners::detail::clip_header& tweeners::clip::header() const
+{
+  return *reinterpret_cast< const detail::clip_header* >( m_data );
+}
+
+#undef tweeners_clip_has_mmap
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef TWEENERS_DETAIL_CLIP_WRITER_TPP
+#define TWEENERS_DETAIL_CLIP_WRITER_TPP
+
+#include <tweeners/contract.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+
+inline tweeners::clip_writer::clip_writer()
+  : m_parameter_count( 0 )
+{
+
+}
+
+/**
+ * \brief Add a tweener starting with the clip.
+ *
+ * \param duration The duration of the tweener.
+ * \param easing The transform of the tweener.
+ * \param parameter The index of the parameter receiving the values.
+ * \param from The value written when the tweener starts.
+ * \param to The value written when the tweener ends.
+ *
+ * \return The index of the node, to be passed as the predecessor of other
+ *         nodes.
+ */
+inline std::uint32_t tweeners::clip_writer::add_node
+( float duration, easing_id easing, std::uint32_t parameter, float from,
+  float to )
+{
+  return
+    add_node
+    ( duration, easing, parameter, from, to, clip_node::no_predecessor );
+}
+
+/**
+ * \brief Add a tweener played after another one.
+ *
+ * \param predecessor The node after which the tweener is played, as returned
+ *        by a previous call to add_node().
+ *
+ * The other parameters are those of the other add_node().
+ */
+inline std::uint32_t tweeners::clip_writer::add_node
+( float duration, easing_id easing, std::uint32_t parameter, float from,
+  float to, std::uint32_t predecessor )
+{
+  tweeners_confirm_contract
+    ( ( predecessor == clip_node::no_predecessor )
+      || ( predecessor < m_nodes.size() ),
+      "clip_writer::add_node(): predecessor does not exist." );
+  tweeners_confirm_contract
+    ( parameter != 0xffffffff,
+      "clip_writer::add_node(): parameter index is too large." );
+
+  clip_node node;
+  std::memset( &node, 0, sizeof( node ) );
+
+  node.duration = duration;
+  node.from = from;
+  node.to = to;
+  node.parameter = parameter;
+  node.predecessor = predecessor;
+  node.easing = static_cast< std::uint8_t >( easing );
+
+  m_nodes.push_back( node );
+  m_parameter_count = std::max( m_parameter_count, parameter + 1 );
+
+  return static_cast< std::uint32_t >( m_nodes.size() - 1 );
+}
+
+/**
+ * \brief Write the clip in a binary stream.
+ */
+inline void tweeners::clip_writer::write( std::ostream& stream ) const
+{
+  detail::clip_header header;
+  std::memcpy( header.magic, "TWCL", 4 );
+  header.version = detail::clip_version;
+  header.byte_order = detail::clip_byte_order;
+  header.node_count = static_cast< std::uint32_t >( m_nodes.size() );
+  header.parameter_count = m_parameter_count;
+
+  stream.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+  stream.write
+    ( reinterpret_cast< const char* >( m_nodes.data() ),
+      m_nodes.size() * sizeof( clip_node ) );
+
+  tweeners_confirm_contract
+    ( stream, "clip_writer::write(): failed to write the clip." );
+}
+
+/**
+ * \brief Write the clip in a file.
+ */
+inline void tweeners::clip_writer::save( const std::string& path ) const
+{
+  std::ofstream f( path, std::ios::binary );
+  tweeners_confirm_contract
+    ( f, "clip_writer::save(): cannot open the file." );
+
+  write( f );
+}
+
+#endif
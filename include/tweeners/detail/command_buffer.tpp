@@ -0,0 +1,324 @@
+#ifndef TWEENERS_DETAIL_COMMAND_BUFFER_TPP
+#define TWEENERS_DETAIL_COMMAND_BUFFER_TPP
+
+#include <tweeners/system.hpp>
+
+template< typename Config >
+tweeners::command_buffer_base< Config >::command_buffer_base
+( system_base< Config >& system )
+  : m_system( system ),
+    m_batch( nullptr )
+{
+
+}
+
+/**
+ * \brief Submit the commands recorded since the last call to submit().
+ */
+template< typename Config >
+tweeners::command_buffer_base< Config >::~command_buffer_base()
+{
+  submit();
+  m_system.m_commands.recycle( m_batch );
+}
+
+/**
+ * \brief Record a call to system_base::configure_slot().
+ *
+ * \return The identifier of the slot to be created when the command is
+ *         applied.
+ *
+ * The identifier is reserved immediately, without locking. It is taken from
+ * the identifiers of the removed slots given to this buffer by the system
+ * when its previous submissions were applied, or a new one if there is
+ * none left.
+ */
+template< typename Config >
+typename tweeners::command_buffer_base< Config >::id_type
+tweeners::command_buffer_base< Config >::configure_slot
+( duration_type duration, update_function update, transform_function transform )
+{
+  batch& b( current_batch() );
+  const id_type slot_id( take_id( b ) );
+
+  add_command
+    ( command_kind::configure, slot_id, b.configures,
+      typename batch::configure_arguments
+      { std::move( duration ), std::move( update ), std::move( transform ) } );
+
+  return slot_id;
+}
+
+/**
+ * \brief Record a call to system_base::configure_slot() with the identifier
+ *        of a built-in easing.
+ *
+ * \sa configure_slot( duration_type, update_function, transform_function )
+ */
+template< typename Config >
+typename tweeners::command_buffer_base< Config >::id_type
+tweeners::command_buffer_base< Config >::configure_slot
+( duration_type duration, update_function update, easing_id easing )
+{
+  batch& b( current_batch() );
+  const id_type slot_id( take_id( b ) );
+
+  add_command
+    ( command_kind::configure_easing, slot_id, b.easing_configures,
+      typename batch::easing_configure_arguments
+      { std::move( duration ), std::move( update ), easing } );
+
+  return slot_id;
+}
+
+/**
+ * \brief Record a call to system_base::configure_slot() with a
+ *        parameterized easing.
+ *
+ * \sa configure_slot( duration_type, update_function, transform_function )
+ */
+template< typename Config >
+typename tweeners::command_buffer_base< Config >::id_type
+tweeners::command_buffer_base< Config >::configure_slot
+( duration_type duration, update_function update,
+  const parameterized_easing< float_type >& easing )
+{
+  batch& b( current_batch() );
+  const id_type slot_id( take_id( b ) );
+
+  add_command
+    ( command_kind::configure_parameterized_easing, slot_id,
+      b.parameterized_easing_configures,
+      typename batch::parameterized_easing_configure_arguments
+      { std::move( duration ), std::move( update ), easing } );
+
+  return slot_id;
+}
+
+/**
+ * \brief Record a call to system_base::start_slot().
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::start_slot( id_type slot_id )
+{
+  add_command( command_kind::start, slot_id, 0 );
+}
+
+/**
+ * \brief Record a call to system_base::on_slot_start().
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::on_slot_start
+( id_type slot_id, void_function callback )
+{
+  add_command
+    ( command_kind::on_start, slot_id, current_batch().callbacks,
+      std::move( callback ) );
+}
+
+/**
+ * \brief Record a call to system_base::on_slot_done().
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::on_slot_done
+( id_type slot_id, void_function callback )
+{
+  add_command
+    ( command_kind::on_done, slot_id, current_batch().callbacks,
+      std::move( callback ) );
+}
+
+/**
+ * \brief Record a call to system_base::play_in_sequence().
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::play_in_sequence
+( id_type first, id_type second )
+{
+  add_command( command_kind::sequence, second, first );
+}
+
+/**
+ * \brief Record a call to system_base::remove_slot().
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::remove_slot( id_type slot_id )
+{
+  add_command( command_kind::remove, slot_id, 0 );
+}
+
+/**
+ * \brief Record a call to system_base::tag_slot().
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::tag_slot
+( id_type slot_id, tag_type tag )
+{
+  add_command( command_kind::tag, slot_id, current_batch().tags, tag );
+}
+
+/**
+ * \brief Record a call to system_base::set_slot_names().
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::set_slot_names
+( id_type slot_id, slot_names names )
+{
+  add_command
+    ( command_kind::set_names, slot_id, current_batch().names,
+      std::move( names ) );
+}
+
+/**
+ * \brief Record a call to system_base::bind_target(), followed by a call to
+ *        either system_base::start_slot() or system_base::play_in_sequence().
+ *
+ * \param slot_id The slot to bind and start.
+ * \param target The address of the variable updated by the slot.
+ * \param policy What to do if another slot is bound to the same target.
+ * \param previous The slot after which slot_id must be played, or
+ *        system_base::not_an_id.
+ *
+ * When the command is applied, the slot is played after \p previous if it is
+ * not system_base::not_an_id, otherwise after the slot returned by
+ * system_base::bind_target() if any, otherwise it is started.
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::bind_target_and_start
+( id_type slot_id, const void* target, overwrite_policy policy,
+  id_type previous )
+{
+  add_command
+    ( command_kind::bind_target_and_start, slot_id, current_batch().targets,
+      typename batch::target_arguments{ target, policy, previous } );
+}
+
+/**
+ * \brief Record a call to system_base::bind_variable().
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::bind_variable
+( id_type slot_id, float_type from, float_type to, float_type& variable )
+{
+  add_command
+    ( command_kind::bind_variable, slot_id, current_batch().variables,
+      typename batch::variable_arguments{ from, to, &variable } );
+}
+
+/**
+ * \brief Record a call to system_base::bind_output( slot_id, from, to ).
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::bind_output
+( id_type slot_id, float_type from, float_type to )
+{
+  bind_output( slot_id, from, to, output_buffer(), slot_id );
+}
+
+/**
+ * \brief Record a call to system_base::bind_output().
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::bind_output
+( id_type slot_id, float_type from, float_type to, output_buffer buffer,
+  std::size_t index )
+{
+  add_command
+    ( command_kind::bind_output, slot_id, current_batch().outputs,
+      typename batch::output_arguments{ from, to, buffer, index } );
+}
+
+/**
+ * \brief Record a call to system_base::bind_group().
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::bind_group
+( id_type slot_id, float_type from, float_type to, update_group group,
+  std::size_t key )
+{
+  add_command
+    ( command_kind::bind_group, slot_id, current_batch().groups,
+      typename batch::group_arguments{ from, to, group, key } );
+}
+
+/**
+ * \brief Push the recorded commands to the system, to be applied during its
+ *        next update.
+ *
+ * This function does not lock, it can be called concurrently with the
+ * submissions of other buffers and with the update of the system.
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::submit()
+{
+  if ( ( m_batch == nullptr ) || m_batch->commands.empty() )
+    return;
+
+  m_system.m_commands.push( m_batch );
+  m_batch = nullptr;
+}
+
+/**
+ * \brief Get the batch in which the commands are recorded, taking one from
+ *        the system if there is none.
+ */
+template< typename Config >
+typename tweeners::command_buffer_base< Config >::batch&
+tweeners::command_buffer_base< Config >::current_batch()
+{
+  if ( m_batch == nullptr )
+    m_batch = m_system.m_commands.acquire_batch();
+
+  return *m_batch;
+}
+
+/**
+ * \brief Get the identifier of a slot to be configured by the commands of a
+ *        batch.
+ *
+ * The identifier is taken from the ones given to the batch by the system, or
+ * reserved if there is none left.
+ */
+template< typename Config >
+typename tweeners::command_buffer_base< Config >::id_type
+tweeners::command_buffer_base< Config >::take_id( batch& b )
+{
+  if ( b.free_ids.empty() )
+    return static_cast< id_type >( m_system.m_commands.reserve_id() );
+
+  const id_type result( b.free_ids.back() );
+  b.free_ids.pop_back();
+
+  return result;
+}
+
+/**
+ * \brief Record a command whose arguments, if any, are already stored.
+ *
+ * \param arguments The index of the arguments of the command, or the
+ *        predecessor of the slot for command_kind::sequence.
+ */
+template< typename Config >
+void tweeners::command_buffer_base< Config >::add_command
+( command_kind what, id_type slot_id, std::size_t arguments )
+{
+  current_batch().commands.push_back
+    ( typename batch::command{ what, slot_id, arguments } );
+}
+
+/**
+ * \brief Record a command and store its arguments in the vector associated
+ *        with its kind.
+ */
+template< typename Config >
+template< typename T >
+void tweeners::command_buffer_base< Config >::add_command
+( command_kind what, id_type slot_id, std::vector< T >& arguments, T value )
+{
+  const std::size_t index( arguments.size() );
+
+  arguments.push_back( std::move( value ) );
+  add_command( what, slot_id, index );
+}
+
+#endif
@@ -0,0 +1,227 @@
+#ifndef TWEENERS_DETAIL_COMMAND_QUEUE_HPP
+#define TWEENERS_DETAIL_COMMAND_QUEUE_HPP
+
+#include <tweeners/easing_id.hpp>
+#include <tweeners/output_buffer.hpp>
+#include <tweeners/overwrite_policy.hpp>
+#include <tweeners/parameterized_easing.hpp>
+#include <tweeners/slot_names.hpp>
+#include <tweeners/update_group.hpp>
+#include <tweeners/detail/config_traits.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace tweeners
+{
+  namespace detail
+  {
+    /**
+     * \brief A set of deferred calls to the functions of tweeners::system,
+     *        pushed at once.
+     *
+     * The commands are stored as a sequence of small headers, the arguments
+     * of each command being stored in the vector associated with its kind.
+     * Thus a command only takes the memory it needs and the batches can be
+     * cleared and reused without releasing their storage.
+     *
+     * \sa tweeners::command_buffer.
+     */
+    template< typename Config >
+    struct command_batch
+    {
+      using duration_type = typename Config::duration_type;
+      using id_type = typename Config::id_type;
+      using float_type = typename Config::float_type;
+      using tag_type = typename config_tag_type< Config >::type;
+
+      template< typename Signature >
+      using function_type =
+        typename Config::template function_type< Signature >;
+
+      enum class kind : char
+        {
+          configure,
+          configure_easing,
+          configure_parameterized_easing,
+          start,
+          on_start,
+          on_done,
+          sequence,
+          remove,
+          tag,
+          bind_target_and_start,
+          bind_variable,
+          bind_output,
+          bind_group,
+          set_names
+        };
+
+      /** \brief The kind and the slot of a command. */
+      struct command
+      {
+        kind what;
+
+        /** \brief The slot on which the command is applied. */
+        id_type slot;
+
+        /**
+         * \brief The index of the arguments of the command in the vector
+         *        associated with its kind, or the predecessor of slot for
+         *        kind::sequence.
+         */
+        std::size_t arguments;
+      };
+
+      /** \brief The arguments of kind::configure. */
+      struct configure_arguments
+      {
+        duration_type duration;
+        function_type< void( float_type ) > update;
+        function_type< float_type( float_type ) > transform;
+      };
+
+      /** \brief The arguments of kind::configure_easing. */
+      struct easing_configure_arguments
+      {
+        duration_type duration;
+        function_type< void( float_type ) > update;
+        easing_id easing;
+      };
+
+      /** \brief The arguments of kind::configure_parameterized_easing. */
+      struct parameterized_easing_configure_arguments
+      {
+        duration_type duration;
+        function_type< void( float_type ) > update;
+        parameterized_easing< float_type > easing;
+      };
+
+      /** \brief The arguments of kind::bind_target_and_start. */
+      struct target_arguments
+      {
+        const void* target;
+        overwrite_policy policy;
+        id_type previous;
+      };
+
+      /** \brief The arguments of kind::bind_variable. */
+      struct variable_arguments
+      {
+        float_type from;
+        float_type to;
+        float_type* variable;
+      };
+
+      /** \brief The arguments of kind::bind_output. */
+      struct output_arguments
+      {
+        float_type from;
+        float_type to;
+        output_buffer buffer;
+        std::size_t index;
+      };
+
+      /** \brief The arguments of kind::bind_group. */
+      struct group_arguments
+      {
+        float_type from;
+        float_type to;
+        update_group group;
+        std::size_t key;
+      };
+
+      static bool is_configure( kind what );
+
+      void clear();
+      std::size_t configure_count() const;
+
+      std::vector< command > commands;
+
+      std::vector< configure_arguments > configures;
+      std::vector< easing_configure_arguments > easing_configures;
+      std::vector< parameterized_easing_configure_arguments >
+      parameterized_easing_configures;
+
+      /** \brief The arguments of kind::on_start and kind::on_done. */
+      std::vector< function_type< void() > > callbacks;
+
+      /** \brief The arguments of kind::tag. */
+      std::vector< tag_type > tags;
+
+      std::vector< target_arguments > targets;
+      std::vector< variable_arguments > variables;
+      std::vector< output_arguments > outputs;
+      std::vector< group_arguments > groups;
+
+      /** \brief The arguments of kind::set_names. */
+      std::vector< slot_names > names;
+
+      /**
+       * \brief Identifiers of available slots, given by the system to the
+       *        buffer recording in this batch.
+       *
+       * The identifiers not used by the buffer are given back to the system
+       * when the batch is applied. They are not removed by clear().
+       */
+      std::vector< id_type > free_ids;
+
+      /** \brief The batch following this one in the list where it is. */
+      command_batch* next;
+    };
+
+    /**
+     * \brief A lock-free multiple producers, single consumer queue of batches
+     *        of commands, plus a lock-free allocator of slot identifiers.
+     *
+     * The producers are the threads submitting commands with
+     * tweeners::command_buffer, and the consumer is the thread owning the
+     * system. The batches are recycled once applied, such that the
+     * producers do not allocate once their batches have reached the size of
+     * their submissions.
+     */
+    template< typename Config >
+    class command_queue
+    {
+    public:
+      using batch = command_batch< Config >;
+      using id_type = typename Config::id_type;
+
+    public:
+      command_queue();
+      command_queue( const command_queue& that );
+      ~command_queue();
+
+      command_queue& operator=( const command_queue& that );
+
+      std::size_t reserve_id();
+      std::size_t reserved_id_count() const;
+      void reserve_ids_below( std::size_t count );
+
+      batch* acquire_batch();
+      void push( batch* b );
+      batch* pop_all();
+      void recycle( batch* b );
+
+    private:
+      static void push_list
+      ( std::atomic< batch* >& head, batch* first, batch* last );
+      static void release( batch* b );
+
+    private:
+      /** \brief The last pushed batch. */
+      std::atomic< batch* > m_head;
+
+      /** \brief The batches applied and available for new commands. */
+      std::atomic< batch* > m_free_batches;
+
+      /** \brief The number of slot identifiers returned by reserve_id(). */
+      std::atomic< std::size_t > m_reserved_id_count;
+    };
+  }
+}
+
+#include <tweeners/detail/command_queue.tpp>
+
+#endif
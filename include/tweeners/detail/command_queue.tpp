@@ -0,0 +1,277 @@
+#ifndef TWEENERS_DETAIL_COMMAND_QUEUE_TPP
+#define TWEENERS_DETAIL_COMMAND_QUEUE_TPP
+
+#include <tweeners/contract.hpp>
+
+#include <limits>
+
+/**
+ * \brief Tell if a command of a given kind configures a new slot.
+ */
+template< typename Config >
+bool tweeners::detail::command_batch< Config >::is_configure( kind what )
+{
+  return ( what == kind::configure ) || ( what == kind::configure_easing )
+    || ( what == kind::configure_parameterized_easing );
+}
+
+/**
+ * \brief Remove the commands of the batch, keeping the storage of their
+ *        arguments and the free identifiers.
+ */
+template< typename Config >
+void tweeners::detail::command_batch< Config >::clear()
+{
+  commands.clear();
+  configures.clear();
+  easing_configures.clear();
+  parameterized_easing_configures.clear();
+  callbacks.clear();
+  tags.clear();
+  targets.clear();
+  variables.clear();
+  outputs.clear();
+  groups.clear();
+  names.clear();
+}
+
+/**
+ * \brief Get the number of slots configured by the commands of the batch.
+ */
+template< typename Config >
+std::size_t tweeners::detail::command_batch< Config >::configure_count() const
+{
+  return configures.size() + easing_configures.size()
+    + parameterized_easing_configures.size();
+}
+
+template< typename Config >
+tweeners::detail::command_queue< Config >::command_queue()
+  : m_head( nullptr ),
+    m_free_batches( nullptr ),
+    m_reserved_id_count( 0 )
+{
+
+}
+
+/**
+ * \brief Copy the state of the identifier allocator.
+ *
+ * The pending commands are not copied: they are applied only on the system
+ * to which they were submitted. Neither are the batches waiting for new
+ * commands, thus the identifiers given to them are not available in the copy.
+ */
+template< typename Config >
+tweeners::detail::command_queue< Config >::command_queue
+( const command_queue& that )
+  : m_head( nullptr ),
+    m_free_batches( nullptr ),
+    m_reserved_id_count( that.m_reserved_id_count.load() )
+{
+
+}
+
+template< typename Config >
+tweeners::detail::command_queue< Config >::~command_queue()
+{
+  release( m_head.load() );
+  release( m_free_batches.load() );
+}
+
+template< typename Config >
+tweeners::detail::command_queue< Config >&
+tweeners::detail::command_queue< Config >::operator=
+( const command_queue& that )
+{
+  m_reserved_id_count = that.m_reserved_id_count.load();
+  return *this;
+}
+
+/**
+ * \brief Get a slot identifier never returned before.
+ *
+ * This function can be called from any thread. If there is no identifier left
+ * in id_type, an exception is thrown and the count of reserved identifiers
+ * is left unchanged.
+ */
+template< typename Config >
+std::size_t tweeners::detail::command_queue< Config >::reserve_id()
+{
+  std::size_t result( m_reserved_id_count.load( std::memory_order_relaxed ) );
+
+  do
+    {
+      tweeners_confirm_contract
+        ( result
+          < static_cast< std::size_t >
+            ( std::numeric_limits< id_type >::max() ),
+          "system: too many slots for id_type." );
+    }
+  while ( !m_reserved_id_count.compare_exchange_weak
+          ( result, result + 1, std::memory_order_relaxed ) );
+
+  return result;
+}
+
+/**
+ * \brief Get the number of slot identifiers returned by reserve_id() or
+ *        reserved with reserve_ids_below().
+ */
+template< typename Config >
+std::size_t tweeners::detail::command_queue< Config >::reserved_id_count() const
+{
+  return m_reserved_id_count.load( std::memory_order_relaxed );
+}
+
+/**
+ * \brief Mark the identifiers lower than a given count as reserved, such that
+ *        reserve_id() never returns them.
+ *
+ * This function must not be called concurrently with reserve_id().
+ */
+template< typename Config >
+void tweeners::detail::command_queue< Config >::reserve_ids_below
+( std::size_t count )
+{
+  tweeners_confirm_contract
+    ( count
+      <= static_cast< std::size_t >( std::numeric_limits< id_type >::max() ),
+      "system: too many slots for id_type." );
+
+  if ( count > m_reserved_id_count.load( std::memory_order_relaxed ) )
+    m_reserved_id_count.store( count, std::memory_order_relaxed );
+}
+
+/**
+ * \brief Get an empty batch in which commands can be recorded.
+ *
+ * The batch is taken from the ones recycled after their application if any,
+ * thus it may have the storage of previous commands.
+ *
+ * This function can be called from any thread.
+ */
+template< typename Config >
+typename tweeners::detail::command_queue< Config >::batch*
+tweeners::detail::command_queue< Config >::acquire_batch()
+{
+  // Taking the whole list prevents the ABA problem of popping a single entry:
+  // the remaining batches are pushed back.
+  batch* const result
+    ( m_free_batches.exchange( nullptr, std::memory_order_acquire ) );
+
+  if ( result == nullptr )
+    return new batch{};
+
+  if ( result->next != nullptr )
+    {
+      batch* last( result->next );
+
+      while ( last->next != nullptr )
+        last = last->next;
+
+      push_list( m_free_batches, result->next, last );
+    }
+
+  result->next = nullptr;
+  return result;
+}
+
+/**
+ * \brief Append a batch of commands to the queue.
+ *
+ * \param b A batch returned by acquire_batch(). The queue takes its
+ *        ownership.
+ *
+ * This function can be called from any thread.
+ */
+template< typename Config >
+void tweeners::detail::command_queue< Config >::push( batch* b )
+{
+  push_list( m_head, b, b );
+}
+
+/**
+ * \brief Remove all the batches from the queue.
+ *
+ * \return The first pushed batch, the following ones being accessible in
+ *         push order via batch::next. The caller is responsible for giving
+ *         the batches back with recycle().
+ *
+ * This function must be called by a single thread.
+ */
+template< typename Config >
+typename tweeners::detail::command_queue< Config >::batch*
+tweeners::detail::command_queue< Config >::pop_all()
+{
+  batch* b( m_head.exchange( nullptr, std::memory_order_acquire ) );
+  batch* result( nullptr );
+
+  // The batches are stacked in reverse push order.
+  while ( b != nullptr )
+    {
+      batch* const next( b->next );
+      b->next = result;
+      result = b;
+      b = next;
+    }
+
+  return result;
+}
+
+/**
+ * \brief Clear a batch and the ones following it, and keep them for the
+ *        next calls to acquire_batch().
+ *
+ * This function can be called from any thread.
+ */
+template< typename Config >
+void tweeners::detail::command_queue< Config >::recycle( batch* b )
+{
+  if ( b == nullptr )
+    return;
+
+  batch* last( b );
+  last->clear();
+
+  while ( last->next != nullptr )
+    {
+      last = last->next;
+      last->clear();
+    }
+
+  push_list( m_free_batches, b, last );
+}
+
+/**
+ * \brief Insert a list of batches on top of a stack, without locking.
+ *
+ * \param head The top of the stack.
+ * \param first The first batch of the list.
+ * \param last The last batch of the list, whose next batch is overwritten.
+ */
+template< typename Config >
+void tweeners::detail::command_queue< Config >::push_list
+( std::atomic< batch* >& head, batch* first, batch* last )
+{
+  last->next = head.load( std::memory_order_relaxed );
+
+  while ( !head.compare_exchange_weak
+          ( last->next, first, std::memory_order_release,
+            std::memory_order_relaxed ) );
+}
+
+/**
+ * \brief Delete a batch and the ones following it.
+ */
+template< typename Config >
+void tweeners::detail::command_queue< Config >::release( batch* b )
+{
+  while ( b != nullptr )
+    {
+      batch* const next( b->next );
+      delete b;
+      b = next;
+    }
+}
+
+#endif
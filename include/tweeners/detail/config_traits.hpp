@@ -0,0 +1,61 @@
+#ifndef TWEENERS_DETAIL_CONFIG_TRAITS_HPP
+#define TWEENERS_DETAIL_CONFIG_TRAITS_HPP
+
+#include <tweeners/easing_id.hpp>
+
+#include <cstdint>
+
+namespace tweeners
+{
+  namespace detail
+  {
+    template< typename T >
+    struct void_type
+    {
+      using type = void;
+    };
+
+    /**
+     * \brief The type of the tags attached to the slots: Config::tag_type if
+     *        it exists, std::uintptr_t otherwise.
+     *
+     * This allows the configurations written before the introduction of the
+     * tags to still be valid.
+     */
+    template< typename Config, typename Enable = void >
+    struct config_tag_type
+    {
+      using type = std::uintptr_t;
+    };
+
+    template< typename Config >
+    struct config_tag_type
+    < Config, typename void_type< typename Config::tag_type >::type >
+    {
+      using type = typename Config::tag_type;
+    };
+
+    /**
+     * \brief The policy used to find the easing functions from their
+     *        identifiers: Config::easing_precision if it exists,
+     *        easing::precise otherwise.
+     */
+    template< typename Config, typename Enable = void >
+    struct config_easing_precision
+    {
+      using type = easing::precise;
+    };
+
+    template< typename Config >
+    struct config_easing_precision
+    <
+      Config,
+      typename void_type< typename Config::easing_precision >::type
+    >
+    {
+      using type = typename Config::easing_precision;
+    };
+  }
+}
+
+#endif
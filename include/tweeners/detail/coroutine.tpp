@@ -0,0 +1,84 @@
+#ifndef TWEENERS_DETAIL_COROUTINE_TPP
+#define TWEENERS_DETAIL_COROUTINE_TPP
+
+#include <tweeners/contract.hpp>
+
+template< typename Config >
+tweeners::slot_awaiter< Config >::slot_awaiter
+( system_base< Config >& system, id_type slot_id )
+  : detail::slot_waiter{ &slot_awaiter::resume_coroutine, nullptr, false },
+    m_system( system ),
+    m_slot( slot_id ),
+    m_waiting( false ),
+    m_completed( false )
+{
+
+}
+
+/**
+ * \brief Remove the coroutine from the waiters of the slot if it is destroyed
+ *        while suspended.
+ */
+template< typename Config >
+tweeners::slot_awaiter< Config >::~slot_awaiter()
+{
+  if ( m_waiting )
+    m_system.m_waiters.remove( m_slot, *this );
+}
+
+template< typename Config >
+bool tweeners::slot_awaiter< Config >::await_ready() const noexcept
+{
+  return false;
+}
+
+template< typename Config >
+void tweeners::slot_awaiter< Config >::await_suspend
+( std::coroutine_handle<> handle )
+{
+  m_handle = handle;
+  m_waiting = true;
+  m_system.m_waiters.push( m_slot, *this );
+}
+
+/**
+ * \brief Tell if the slot has completed, as opposed to being removed.
+ */
+template< typename Config >
+bool tweeners::slot_awaiter< Config >::await_resume() const noexcept
+{
+  return m_completed;
+}
+
+template< typename Config >
+void tweeners::slot_awaiter< Config >::resume_coroutine
+( detail::slot_waiter& self, bool completed )
+{
+  slot_awaiter& awaiter( static_cast< slot_awaiter& >( self ) );
+
+  awaiter.m_waiting = false;
+  awaiter.m_completed = completed;
+  awaiter.m_handle.resume();
+}
+
+/**
+ * \brief Get an object suspending the calling coroutine until a slot
+ *        completes.
+ *
+ * \param slot_id The slot to wait for.
+ *
+ * This function is available by including tweeners/coroutine.hpp.
+ *
+ * \sa slot_awaiter.
+ */
+template< typename Config >
+tweeners::slot_awaiter< Config >
+tweeners::system_base< Config >::done( id_type slot_id )
+{
+  tweeners_confirm_contract
+    ( is_valid_slot_id( slot_id ), "system::done(): slot does not exist." );
+
+  return slot_awaiter< Config >( *this, slot_id );
+}
+
+#endif
@@ -0,0 +1,212 @@
+#ifndef TWEENERS_DETAIL_CUBIC_BEZIER_TPP
+#define TWEENERS_DETAIL_CUBIC_BEZIER_TPP
+
+#include <tweeners/contract.hpp>
+#include <tweeners/detail/cubic_bezier_cache.hpp>
+#include <tweeners/detail/debug.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+/**
+ * \brief The coefficients of a cubic_bezier and the parameters of the curve
+ *        for evenly spaced abscissas.
+ */
+template< typename Float >
+class tweeners::easing::cubic_bezier< Float >::table
+{
+public:
+  table( Float x1, Float y1, Float x2, Float y2 );
+
+  Float evaluate( Float t ) const;
+
+private:
+  Float x( Float u ) const;
+  Float dx( Float u ) const;
+  Float y( Float u ) const;
+
+  Float solve( Float t, Float low, Float high ) const;
+
+private:
+  static constexpr std::size_t segment_count = 128;
+
+  /**
+   * \name Polynomial coefficients
+   *
+   * The curve is x( u ) = ( ( a_x * u + b_x ) * u + c_x ) * u, and the same
+   * for y.
+   */
+  ///@{
+  Float m_ax;
+  Float m_bx;
+  Float m_cx;
+  Float m_ay;
+  Float m_by;
+  Float m_cy;
+  ///@}
+
+  /**
+   * \brief The parameter of the curve whose abscissa is i / segment_count,
+   *        at index i.
+   */
+  std::array< Float, segment_count + 1 > m_parameters;
+};
+
+template< typename Float >
+tweeners::easing::cubic_bezier< Float >::table::table
+( Float x1, Float y1, Float x2, Float y2 )
+  : m_cx( 3 * x1 ),
+    m_cy( 3 * y1 )
+{
+  m_bx = 3 * ( x2 - x1 ) - m_cx;
+  m_ax = 1 - m_cx - m_bx;
+  m_by = 3 * ( y2 - y1 ) - m_cy;
+  m_ay = 1 - m_cy - m_by;
+
+  m_parameters[ 0 ] = 0;
+  m_parameters[ segment_count ] = 1;
+
+  for ( std::size_t i( 1 ); i != segment_count; ++i )
+    m_parameters[ i ] = solve( Float( i ) / segment_count, 0, 1 );
+}
+
+/**
+ * \brief Get the ordinate of the point of the curve whose abscissa is t.
+ */
+template< typename Float >
+Float tweeners::easing::cubic_bezier< Float >::table::evaluate( Float t ) const
+{
+  const Float position( t * segment_count );
+  const std::size_t i
+    ( std::min( std::size_t( position ), segment_count - 1 ) );
+  const Float f( position - i );
+
+  const Float low( m_parameters[ i ] );
+  const Float high( m_parameters[ i + 1 ] );
+  Float u( low + f * ( high - low ) );
+  const Float d( dx( u ) );
+
+  if ( d > 0 )
+    u = std::min( high, std::max( low, u - ( x( u ) - t ) / d ) );
+
+  // The Newton step converges slowly where the derivative vanishes, at the
+  // ends of some curves or at an inflection point. The few samples falling
+  // there are solved in their segment.
+  if ( std::abs( x( u ) - t ) > Float( 1e-6 ) )
+    u = solve( t, low, high );
+
+  return y( u );
+}
+
+template< typename Float >
+Float tweeners::easing::cubic_bezier< Float >::table::x( Float u ) const
+{
+  return ( ( m_ax * u + m_bx ) * u + m_cx ) * u;
+}
+
+template< typename Float >
+Float tweeners::easing::cubic_bezier< Float >::table::dx( Float u ) const
+{
+  return ( 3 * m_ax * u + 2 * m_bx ) * u + m_cx;
+}
+
+template< typename Float >
+Float tweeners::easing::cubic_bezier< Float >::table::y( Float u ) const
+{
+  return ( ( m_ay * u + m_by ) * u + m_cy ) * u;
+}
+
+/**
+ * \brief Find the parameter of the curve whose abscissa is t, in an interval
+ *        of parameters containing it.
+ *
+ * The abscissa is monotonic since the control points have their abscissa in
+ * [0, 1]. The search does Newton steps, replaced by a bisection when the step
+ * leaves the interval.
+ */
+template< typename Float >
+Float tweeners::easing::cubic_bezier< Float >::table::solve
+( Float t, Float low, Float high ) const
+{
+  Float u( ( low + high ) / 2 );
+
+  for ( int i( 0 ); i != 100; ++i )
+    {
+      const Float error( x( u ) - t );
+
+      if ( error == 0 )
+        break;
+
+      if ( error < 0 )
+        low = u;
+      else
+        high = u;
+
+      const Float d( dx( u ) );
+      Float next( ( low + high ) / 2 );
+
+      if ( d > 0 )
+        {
+          const Float newton( u - error / d );
+
+          if ( ( low < newton ) && ( newton < high ) )
+            next = newton;
+        }
+
+      if ( next == u )
+        break;
+
+      u = next;
+    }
+
+  return u;
+}
+
+/**
+ * \brief Create the curve of cubic-bezier( x1, y1, x2, y2 ).
+ *
+ * \param x1 The abscissa of the first control point, in [0, 1].
+ * \param y1 The ordinate of the first control point.
+ * \param x2 The abscissa of the second control point, in [0, 1].
+ * \param y2 The ordinate of the second control point.
+ */
+template< typename Float >
+tweeners::easing::cubic_bezier< Float >::cubic_bezier
+( Float x1, Float y1, Float x2, Float y2 )
+  : m_table( find_table( x1, y1, x2, y2 ) )
+{
+
+}
+
+template< typename Float >
+Float tweeners::easing::cubic_bezier< Float >::operator()( Float t ) const
+{
+  tweeners_debug_assert( Float( 0 ) <= t );
+  tweeners_debug_assert( t <= Float( 1 ) );
+
+  return m_table->evaluate( t );
+}
+
+/**
+ * \brief Get the table of the curve with the given control points, shared
+ *        with the other easings having the same points.
+ */
+template< typename Float >
+std::shared_ptr
+<
+  const typename tweeners::easing::cubic_bezier< Float >::table
+>
+tweeners::easing::cubic_bezier< Float >::find_table
+( Float x1, Float y1, Float x2, Float y2 )
+{
+  tweeners_confirm_contract
+    ( ( 0 <= x1 ) && ( x1 <= 1 ) && ( 0 <= x2 ) && ( x2 <= 1 ),
+      "easing::cubic_bezier: the abscissas must be in [0, 1]." );
+
+  static detail::cubic_bezier_cache< table, Float > tables;
+
+  return tables.get( x1, y1, x2, y2 );
+}
+
+#endif
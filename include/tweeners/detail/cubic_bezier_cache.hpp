@@ -0,0 +1,68 @@
+#ifndef TWEENERS_DETAIL_CUBIC_BEZIER_CACHE_HPP
+#define TWEENERS_DETAIL_CUBIC_BEZIER_CACHE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace tweeners
+{
+  namespace detail
+  {
+    /**
+     * \brief The tables of the cubic Bézier easings, indexed by their control
+     *        points, such that the easings with the same points share their
+     *        table.
+     *
+     * The cache keeps the tables as long as an easing uses them. The expired
+     * entries are not searched at each insertion: they are purged when the
+     * number of entries has doubled since the previous purge, thus the cost
+     * of an insertion is constant on average.
+     *
+     * \tparam Table The table of a curve, constructible from the control
+     *         points.
+     */
+    template< typename Table, typename Float >
+    class cubic_bezier_cache
+    {
+    public:
+      cubic_bezier_cache();
+
+      std::shared_ptr< const Table >
+      get( Float x1, Float y1, Float x2, Float y2 );
+
+    private:
+      /** \brief The control points of a curve. */
+      struct key
+      {
+        bool operator==( const key& that ) const;
+
+        Float x1;
+        Float y1;
+        Float x2;
+        Float y2;
+      };
+
+      struct key_hash
+      {
+        std::size_t operator()( const key& k ) const;
+      };
+
+    private:
+      void purge();
+
+    private:
+      std::mutex m_mutex;
+      std::unordered_map< key, std::weak_ptr< const Table >, key_hash >
+      m_tables;
+
+      /** \brief The number of entries from which the cache is purged. */
+      std::size_t m_purge_size;
+    };
+  }
+}
+
+#include <tweeners/detail/cubic_bezier_cache.tpp>
+
+#endif
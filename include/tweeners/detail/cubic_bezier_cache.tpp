@@ -0,0 +1,79 @@
+#ifndef TWEENERS_DETAIL_CUBIC_BEZIER_CACHE_TPP
+#define TWEENERS_DETAIL_CUBIC_BEZIER_CACHE_TPP
+
+#include <algorithm>
+#include <functional>
+
+template< typename Table, typename Float >
+bool tweeners::detail::cubic_bezier_cache< Table, Float >::key::operator==
+( const key& that ) const
+{
+  return ( x1 == that.x1 ) && ( y1 == that.y1 ) && ( x2 == that.x2 )
+    && ( y2 == that.y2 );
+}
+
+template< typename Table, typename Float >
+std::size_t
+tweeners::detail::cubic_bezier_cache< Table, Float >::key_hash::operator()
+( const key& k ) const
+{
+  const std::hash< Float > hash;
+  std::size_t result( hash( k.x1 ) );
+
+  for ( Float v : { k.y1, k.x2, k.y2 } )
+    result = ( result * 31 ) ^ hash( v );
+
+  return result;
+}
+
+template< typename Table, typename Float >
+tweeners::detail::cubic_bezier_cache< Table, Float >::cubic_bezier_cache()
+  : m_purge_size( 16 )
+{
+
+}
+
+/**
+ * \brief Get the table of the curve with the given control points, creating
+ *        it if no easing uses it.
+ *
+ * This function can be called from any thread.
+ */
+template< typename Table, typename Float >
+std::shared_ptr< const Table >
+tweeners::detail::cubic_bezier_cache< Table, Float >::get
+( Float x1, Float y1, Float x2, Float y2 )
+{
+  const std::lock_guard< std::mutex > lock( m_mutex );
+
+  std::weak_ptr< const Table >& entry( m_tables[ key{ x1, y1, x2, y2 } ] );
+  std::shared_ptr< const Table > result( entry.lock() );
+
+  if ( result )
+    return result;
+
+  result = std::make_shared< const Table >( x1, y1, x2, y2 );
+  entry = result;
+
+  if ( m_tables.size() >= m_purge_size )
+    purge();
+
+  return result;
+}
+
+/**
+ * \brief Forget the tables not used anymore.
+ */
+template< typename Table, typename Float >
+void tweeners::detail::cubic_bezier_cache< Table, Float >::purge()
+{
+  for ( auto it( m_tables.begin() ); it != m_tables.end(); )
+    if ( it->second.expired() )
+      it = m_tables.erase( it );
+    else
+      ++it;
+
+  m_purge_size = std::max< std::size_t >( 16, 2 * m_tables.size() );
+}
+
+#endif
@@ -1,9 +1,14 @@
 #ifndef TWEENER_EASING_TPP
 #define TWEENER_EASING_TPP
 
+#include <tweeners/contract.hpp>
 #include <tweeners/detail/debug.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 
 #define tweeners_debug_check_easing_bounds( t )        \
   do                                            \
@@ -13,6 +18,17 @@
     }                                           \
   while( false )
 
+// The fast_* easings and their helpers are computed without contracting their
+// operations into fused multiply-adds, such that they give the same bits on
+// every target. Clang accepts this pragma at the beginning of the functions,
+// while GCC and MSVC receive theirs before the definitions, GCC restoring its
+// options after them.
+#if defined( __clang__ )
+  #define tweeners_disable_fp_contract() _Pragma( "clang fp contract(off)" )
+#else
+  #define tweeners_disable_fp_contract()
+#endif
+
 template< typename Float, typename Easing >
 Float tweeners::easing::ease_out( Float t, Easing&& function )
 {
@@ -33,10 +49,31 @@ Float tweeners::easing::ease_in_out( Float t, Easing&& function )
       
   return Float( 0.5 ) + ease_out( 2 * t - 1, function ) / 2;
 }
+
+/**
+ * \brief The composition of ease_out() with a given function, as a function
+ *        usable as a transform.
+ */
+template< typename Float, Float ( *Function )( Float ) >
+Float tweeners::easing::out( Float t )
+{
+  return ease_out( t, Function );
+}
+
+/**
+ * \brief The composition of ease_in_out() with a given function, as a function
+ *        usable as a transform.
+ */
+template< typename Float, Float ( *Function )( Float ) >
+Float tweeners::easing::in_out( Float t )
+{
+  return ease_in_out( t, Function );
+}
     
 template< typename Float >
 Float tweeners::easing::none( Float t )
 {
+  (void)t;
   tweeners_debug_check_easing_bounds( t );
   return 0;
 }
@@ -151,6 +188,561 @@ Float tweeners::easing::back( Float t )
   return t * t * ( ( s + 1 ) * t - s );
 }
 
+namespace tweeners
+{
+  namespace detail
+  {
+    /**
+     * \brief The offset of the oscillations of an elastic easing such that
+     *        it starts at zero.
+     *
+     * As in the equations of Robert Penner, an amplitude lower than one is
+     * treated as one.
+     */
+    template< typename Float >
+    Float elastic_shift( Float amplitude, Float period )
+    {
+      if ( amplitude <= 1 )
+        return period / 4;
+
+      return period / Float( 2 * M_PI ) * std::asin( 1 / amplitude );
+    }
+
+    /**
+     * \brief The elastic easing for a shift computed by elastic_shift().
+     */
+    template< typename Float >
+    Float elastic_with_shift
+    ( Float t, Float amplitude, Float period, Float shift )
+    {
+      const Float pi( M_PI );
+      const Float v( t - 1 );
+
+      return -std::max( amplitude, Float( 1 ) ) * std::pow( 2, 10 * v )
+        * std::sin( ( v - shift ) * 2 * pi / period );
+    }
+  }
+}
+
+/**
+ * \brief The elastic easing with a given amplitude and period of the
+ *        oscillations. elastic() uses an amplitude of 1 and a period of 0.3.
+ *
+ * An amplitude lower than one is treated as one.
+ */
+template< typename Float >
+Float tweeners::easing::elastic_with( Float t, Float amplitude, Float period )
+{
+  tweeners_debug_check_easing_bounds( t );
+
+  return detail::elastic_with_shift
+    ( t, amplitude, period, detail::elastic_shift( amplitude, period ) );
+}
+
+/**
+ * \brief The back easing with a given overshoot. back() uses an overshoot of
+ *        1.70158, which goes about 10% under zero.
+ */
+template< typename Float >
+Float tweeners::easing::back_with( Float t, Float overshoot )
+{
+  tweeners_debug_check_easing_bounds( t );
+  return t * t * ( ( overshoot + 1 ) * t - overshoot );
+}
+
+/**
+ * \brief A staircase of \a count steps of equal length, jumping at the end
+ *        of each step.
+ */
+template< typename Float >
+Float tweeners::easing::steps( Float t, Float count )
+{
+  tweeners_debug_check_easing_bounds( t );
+  return std::floor( t * count ) / count;
+}
+
+/**
+ * \brief t raised to a given exponent. quad() to quint() are the powers 2
+ *        to 5.
+ */
+template< typename Float >
+Float tweeners::easing::power( Float t, Float exponent )
+{
+  tweeners_debug_check_easing_bounds( t );
+  return std::pow( t, exponent );
+}
+
+#if defined( __GNUC__ ) && !defined( __clang__ )
+  #pragma GCC push_options
+  #pragma GCC optimize( "fp-contract=off" )
+#elif defined( _MSC_VER )
+  #pragma fp_contract( off )
+#endif
+
+namespace tweeners
+{
+  namespace detail
+  {
+    /**
+     * \brief Compute 2^n for an integer n in [-126, 127] by building the
+     *        exponent of the result.
+     */
+    inline float exp2_integer( float, int n )
+    {
+      const std::uint32_t bits( std::uint32_t( n + 127 ) << 23 );
+      float result;
+      std::memcpy( &result, &bits, sizeof( result ) );
+
+      return result;
+    }
+
+    inline double exp2_integer( double, int n )
+    {
+      const std::uint64_t bits( std::uint64_t( n + 1023 ) << 52 );
+      double result;
+      std::memcpy( &result, &bits, sizeof( result ) );
+
+      return result;
+    }
+
+    /**
+     * \brief Compute 2^( 10 * ( t - 1 ) ) for t in [0, 1] with a minimax
+     *        polynomial approximation of 2^f for f in [-0.5, 0.5].
+     *
+     * The relative error of the polynomial is below 2.4e-10.
+     */
+    template< typename Float >
+    Float fast_exp2_ten( Float t )
+    {
+      tweeners_disable_fp_contract();
+
+      const Float y( 10 * ( t - 1 ) );
+
+      // y is in [-10, 0], thus the truncation of 0.5 - y rounds -y.
+      const int n( int( Float( 0.5 ) - y ) );
+      const Float f( y + n );
+
+      const Float p
+        ( Float( 1 ) + f * ( Float( 0.6931471838168765 )
+        + f * ( Float( 0.2402265092078223 )
+        + f * ( Float( 0.05550400375288427 )
+        + f * ( Float( 0.009618056919446956 )
+        + f * ( Float( 0.0013341951024144225 )
+        + f * ( Float( 0.00015461367624128677 )
+        + f * Float( 1.3359826885250742e-05 ) ) ) ) ) ) ) );
+
+      return p * exp2_integer( Float(), -n );
+    }
+
+    /**
+     * \brief Compute sin( 2 * pi * w ) for w <= 0 with a minimax polynomial
+     *        approximation of sin( pi * b ) for b in [0, 0.5].
+     *
+     * The absolute error of the polynomial is below 1.4e-11.
+     */
+    template< typename Float >
+    Float fast_sin_turns( Float w )
+    {
+      tweeners_disable_fp_contract();
+
+      tweeners_debug_assert( w <= 0 );
+
+      // Bring w in [-0.5, 0.5] such that s is in [-1, 1], then use the
+      // symmetry sin( pi * a ) = sin( pi * ( 1 - a ) ) to get b in [0, 0.5].
+      const int k( int( Float( 0.5 ) - w ) );
+      const Float s( 2 * ( w + k ) );
+      const Float a( std::abs( s ) );
+      const Float b( std::min( a, 1 - a ) );
+      const Float b2( b * b );
+
+      const Float p
+        ( b * ( Float( 3.1415926532437544 )
+        + b2 * ( Float( -5.167712741221674 )
+        + b2 * ( Float( 2.5501627947221452 )
+        + b2 * ( Float( -0.5992474049031811 )
+        + b2 * ( Float( 0.08203123010139825 )
+        + b2 * Float( -0.007000500260225069 ) ) ) ) ) ) );
+
+      return ( 1 - 2 * Float( s < 0 ) ) * p;
+    }
+
+    /**
+     * \brief An estimate of 1 / sqrt( x ) for x >= 0, from the bits of x,
+     *        with a relative error below 3.5e-2.
+     */
+    inline float inverse_sqrt_estimate( float x )
+    {
+      std::uint32_t bits;
+      std::memcpy( &bits, &x, sizeof( x ) );
+      bits = 0x5f3759df - ( bits >> 1 );
+
+      float result;
+      std::memcpy( &result, &bits, sizeof( result ) );
+
+      return result;
+    }
+
+    inline double inverse_sqrt_estimate( double x )
+    {
+      std::uint64_t bits;
+      std::memcpy( &bits, &x, sizeof( x ) );
+      bits = 0x5fe6eb50c7b537a9 - ( bits >> 1 );
+
+      double result;
+      std::memcpy( &result, &bits, sizeof( result ) );
+
+      return result;
+    }
+
+    /** \brief The number of Newton steps done by fast_sqrt(). */
+    inline constexpr int fast_sqrt_steps( float )
+    {
+      return 3;
+    }
+
+    inline constexpr int fast_sqrt_steps( double )
+    {
+      return 4;
+    }
+
+    /**
+     * \brief Compute sqrt( x ) for x in [0, 1] by refining
+     *        inverse_sqrt_estimate() with Newton steps.
+     *
+     * Each step squares the relative error, thus the result is as accurate
+     * as the arithmetic allows. The estimate for zero is finite, thus the
+     * result is zero.
+     */
+    template< typename Float >
+    Float fast_sqrt( Float x )
+    {
+      tweeners_disable_fp_contract();
+
+      Float y( inverse_sqrt_estimate( x ) );
+      const Float half_x( x / 2 );
+
+      for ( int i( 0 ); i != fast_sqrt_steps( Float() ); ++i )
+        y = y * ( Float( 1.5 ) - half_x * y * y );
+
+      return x * y;
+    }
+  }
+}
+
+/**
+ * \brief An approximation of sine() by a minimax polynomial.
+ *
+ * The fast_* easings use only additions, multiplications and comparisons, with
+ * no branches and no call to the math library, such that they can be
+ * vectorized. Their largest absolute difference over [0, 1] with the
+ * approximated easing, evaluated in double precision, is:
+ *
+ * | easing         | float  | double  |
+ * |----------------|--------|---------|
+ * | fast_sine()    | 1.5e-7 | 8.2e-13 |
+ * | fast_circ()    | 1.9e-7 | 2.1e-14 |
+ * | fast_expo()    | 6.2e-8 | 2.2e-10 |
+ * | fast_elastic() | 6.6e-7 | 2.2e-10 |
+ *
+ * The contraction of their operations into fused multiply-adds is disabled,
+ * such that the results have the same bits on every target and with every
+ * optimization level. With GCC, the option disabling it prevents inlining
+ * these functions in code compiled with other options.
+ */
+template< typename Float >
+Float tweeners::easing::fast_sine( Float t )
+{
+  tweeners_disable_fp_contract();
+  tweeners_debug_check_easing_bounds( t );
+
+  // 1 - cos( pi / 2 * t ) as a polynomial in t^2.
+  const Float t2( t * t );
+
+  return t2 * ( Float( 1.2337005500853029 )
+    + t2 * ( Float( -0.2536695069105274 )
+    + t2 * ( Float( 0.020863474339251356 )
+    + t2 * ( Float( -0.0009192411077005169 )
+    + t2 * ( Float( 2.5173089888914516e-05 )
+    + t2 * Float( -4.494970327178717e-07 ) ) ) ) ) );
+}
+
+/**
+ * \brief An approximation of circ() without call to the math library.
+ *
+ * circ() has an infinite derivative at 1, where no polynomial can follow it,
+ * thus the square root is computed by Newton steps from an estimate built
+ * from the bits of its argument.
+ *
+ * \sa fast_sine() for the guarantees.
+ */
+template< typename Float >
+Float tweeners::easing::fast_circ( Float t )
+{
+  tweeners_disable_fp_contract();
+  tweeners_debug_check_easing_bounds( t );
+  return 1 - detail::fast_sqrt( ( 1 - t ) * ( 1 + t ) );
+}
+
+/**
+ * \brief An approximation of expo() by a minimax polynomial.
+ *
+ * \sa fast_sine() for the guarantees.
+ */
+template< typename Float >
+Float tweeners::easing::fast_expo( Float t )
+{
+  tweeners_disable_fp_contract();
+  tweeners_debug_check_easing_bounds( t );
+  return Float( t != 0 ) * detail::fast_exp2_ten( t );
+}
+
+/**
+ * \brief An approximation of elastic() by minimax polynomials.
+ *
+ * \sa fast_sine() for the guarantees.
+ */
+template< typename Float >
+Float tweeners::easing::fast_elastic( Float t )
+{
+  tweeners_disable_fp_contract();
+  tweeners_debug_check_easing_bounds( t );
+
+  // With p = 0.3, the sine of elastic() is sin( 2 * pi * ( v - p / 4 ) / p ).
+  const Float w( ( t - Float( 1.075 ) ) * Float( 10. / 3 ) );
+
+  return -detail::fast_exp2_ten( t ) * detail::fast_sin_turns( w );
+}
+
+#if defined( __GNUC__ ) && !defined( __clang__ )
+  #pragma GCC pop_options
+#endif
+
+namespace tweeners
+{
+  namespace detail
+  {
+    /**
+     * \brief The values of an easing function at Resolution + 1 evenly spaced
+     *        ratios, computed on the first use.
+     */
+    template
+    <
+      typename Float,
+      Float ( *Function )( Float ),
+      std::size_t Resolution
+    >
+    const std::array< Float, Resolution + 1 >& easing_table()
+    {
+      static_assert( Resolution > 0, "The resolution must be positive." );
+
+      static const std::array< Float, Resolution + 1 > result
+        ( []() -> std::array< Float, Resolution + 1 >
+          {
+            std::array< Float, Resolution + 1 > values;
+
+            for ( std::size_t i( 0 ); i != Resolution + 1; ++i )
+              values[ i ] = Function( Float( i ) / Resolution );
+
+            return values;
+          }() );
+
+      return result;
+    }
+  }
+}
+
+/**
+ * \brief An approximation of a function by linear interpolation in a table of
+ *        its values.
+ *
+ * \tparam Function The approximated easing, for example
+ *         easing::elastic< float > or easing::out< float, easing::sine >.
+ * \tparam Resolution The number of intervals in the table.
+ *
+ * The table is computed once per process, on the first call. The values at 0
+ * and 1 are exact. The largest difference with the approximated function is
+ * given by tabulated_max_error().
+ */
+template< typename Float, Float ( *Function )( Float ), std::size_t Resolution >
+Float tweeners::easing::tabulated( Float t )
+{
+  tweeners_debug_check_easing_bounds( t );
+
+  const std::array< Float, Resolution + 1 >& values
+    ( detail::easing_table< Float, Function, Resolution >() );
+
+  const Float position( t * Resolution );
+  const std::size_t i
+    ( std::min( std::size_t( position ), Resolution - 1 ) );
+  const Float f( position - i );
+
+  return ( 1 - f ) * values[ i ] + f * values[ i + 1 ];
+}
+
+/**
+ * \brief Get the largest difference between tabulated() and the approximated
+ *        function.
+ *
+ * The error is measured once per process, on the first call, by sampling each
+ * interval of the table. It is an estimate: the error between two samples may
+ * be slightly larger.
+ */
+template< typename Float, Float ( *Function )( Float ), std::size_t Resolution >
+Float tweeners::easing::tabulated_max_error()
+{
+  static const Float result
+    ( []() -> Float
+      {
+        constexpr std::size_t samples_per_interval( 64 );
+        constexpr std::size_t sample_count
+          ( Resolution * samples_per_interval );
+
+        Float error( 0 );
+
+        for ( std::size_t i( 0 ); i != sample_count + 1; ++i )
+          {
+            const Float t( Float( i ) / sample_count );
+            error =
+              std::max
+              ( error,
+                Float
+                ( std::abs
+                  ( tabulated< Float, Function, Resolution >( t )
+                    - Function( t ) ) ) );
+          }
+
+        return error;
+      }() );
+
+  return result;
+}
+
+/**
+ * \brief Create a curve passing through given points.
+ *
+ * \param points The points of the curve, sorted by strictly increasing
+ *        abscissa. There must be at least two points, the first at the
+ *        abscissa 0 and the last at the abscissa 1.
+ * \param resolution The number of intervals of the table of values. The
+ *        curve is exact at the ratios multiple of 1 / resolution.
+ */
+template< typename Float >
+tweeners::easing::sampled_curve< Float >::sampled_curve
+( const std::vector< point >& points, std::size_t resolution )
+{
+  tweeners_confirm_contract
+    ( points.size() >= 2, "easing::sampled_curve: a curve needs two points." );
+  tweeners_confirm_contract
+    ( ( points.front().x == 0 ) && ( points.back().x == 1 ),
+      "easing::sampled_curve: the curve must go from 0 to 1." );
+  tweeners_confirm_contract
+    ( resolution >= 1,
+      "easing::sampled_curve: the resolution must be positive." );
+
+  for ( std::size_t i( 1 ); i != points.size(); ++i )
+    tweeners_confirm_contract
+      ( points[ i - 1 ].x < points[ i ].x,
+        "easing::sampled_curve: the points are not sorted." );
+
+  const std::vector< Float > tangents( monotone_tangents( points ) );
+  std::vector< Float > values( resolution + 1 );
+  std::size_t k( 0 );
+
+  for ( std::size_t i( 0 ); i <= resolution; ++i )
+    {
+      const Float x( Float( i ) / resolution );
+
+      while ( ( k + 2 < points.size() ) && ( points[ k + 1 ].x <= x ) )
+        ++k;
+
+      // Cubic Hermite interpolation in the k-th interval.
+      const Float h( points[ k + 1 ].x - points[ k ].x );
+      const Float s( ( x - points[ k ].x ) / h );
+      const Float s2( s * s );
+      const Float s3( s2 * s );
+
+      values[ i ] =
+        ( 2 * s3 - 3 * s2 + 1 ) * points[ k ].y
+        + ( s3 - 2 * s2 + s ) * h * tangents[ k ]
+        + ( 3 * s2 - 2 * s3 ) * points[ k + 1 ].y
+        + ( s3 - s2 ) * h * tangents[ k + 1 ];
+    }
+
+  values[ 0 ] = points.front().y;
+  values[ resolution ] = points.back().y;
+
+  m_values =
+    std::make_shared< const std::vector< Float > >( std::move( values ) );
+}
+
+template< typename Float >
+Float tweeners::easing::sampled_curve< Float >::operator()( Float t ) const
+{
+  tweeners_debug_check_easing_bounds( t );
+
+  const std::vector< Float >& values( *m_values );
+  const std::size_t intervals( values.size() - 1 );
+  const Float position( t * intervals );
+  const std::size_t i( std::min( std::size_t( position ), intervals - 1 ) );
+  const Float f( position - i );
+
+  return values[ i ] + f * ( values[ i + 1 ] - values[ i ] );
+}
+
+/**
+ * \brief Compute the tangents of the curve at the points with the method of
+ *        Fritsch and Carlson.
+ *
+ * The tangents are initialized with the mean of the slopes of the adjacent
+ * intervals, or zero at the local extrema, then they are scaled down where
+ * they would make the curve overshoot in an interval.
+ */
+template< typename Float >
+std::vector< Float >
+tweeners::easing::sampled_curve< Float >::monotone_tangents
+( const std::vector< point >& points )
+{
+  const std::size_t n( points.size() );
+  std::vector< Float > slopes( n - 1 );
+
+  for ( std::size_t k( 0 ); k != n - 1; ++k )
+    slopes[ k ] =
+      ( points[ k + 1 ].y - points[ k ].y )
+      / ( points[ k + 1 ].x - points[ k ].x );
+
+  std::vector< Float > result( n );
+  result[ 0 ] = slopes[ 0 ];
+  result[ n - 1 ] = slopes[ n - 2 ];
+
+  for ( std::size_t k( 1 ); k != n - 1; ++k )
+    if ( slopes[ k - 1 ] * slopes[ k ] > 0 )
+      result[ k ] = ( slopes[ k - 1 ] + slopes[ k ] ) / 2;
+    else
+      result[ k ] = 0;
+
+  for ( std::size_t k( 0 ); k != n - 1; ++k )
+    if ( slopes[ k ] == 0 )
+      {
+        result[ k ] = 0;
+        result[ k + 1 ] = 0;
+      }
+    else
+      {
+        const Float a( result[ k ] / slopes[ k ] );
+        const Float b( result[ k + 1 ] / slopes[ k ] );
+        const Float norm( a * a + b * b );
+
+        if ( norm > 9 )
+          {
+            const Float tau( 3 / std::sqrt( norm ) );
+            result[ k ] = tau * a * slopes[ k ];
+            result[ k + 1 ] = tau * b * slopes[ k ];
+          }
+      }
+
+  return result;
+}
+
 #undef tweeners_debug_check_easing_bounds
 
 #endif
@@ -0,0 +1,248 @@
+#ifndef TWEENERS_DETAIL_EASING_FUNCTORS_TPP
+#define TWEENERS_DETAIL_EASING_FUNCTORS_TPP
+
+#include <tweeners/easing.hpp>
+
+#include <cstdint>
+
+template< typename Float >
+constexpr Float tweeners::easing::none_t::operator()( Float ) const
+{
+  return 0;
+}
+
+template< typename Float >
+constexpr Float tweeners::easing::linear_t::operator()( Float t ) const
+{
+  return t;
+}
+
+template< typename Float >
+Float tweeners::easing::sine_t::operator()( Float t ) const
+{
+  return sine( t );
+}
+
+template< typename Float >
+constexpr Float tweeners::easing::quad_t::operator()( Float t ) const
+{
+  return t * t;
+}
+
+template< typename Float >
+constexpr Float tweeners::easing::cubic_t::operator()( Float t ) const
+{
+  return t * t * t;
+}
+
+template< typename Float >
+constexpr Float tweeners::easing::quart_t::operator()( Float t ) const
+{
+  return t * t * t * t;
+}
+
+template< typename Float >
+constexpr Float tweeners::easing::quint_t::operator()( Float t ) const
+{
+  return t * t * t * t * t;
+}
+
+template< typename Float >
+Float tweeners::easing::circ_t::operator()( Float t ) const
+{
+  return circ( t );
+}
+
+template< typename Float >
+Float tweeners::easing::expo_t::operator()( Float t ) const
+{
+  return expo( t );
+}
+
+template< typename Float >
+Float tweeners::easing::elastic_t::operator()( Float t ) const
+{
+  return elastic( t );
+}
+
+template< typename Float >
+Float tweeners::easing::bounce_t::operator()( Float t ) const
+{
+  return bounce( t );
+}
+
+template< typename Float >
+constexpr Float tweeners::easing::back_t::operator()( Float t ) const
+{
+  // Same as back(), with s = 1.70158.
+  return t * t * ( ( Float( 1.70158 ) + 1 ) * t - Float( 1.70158 ) );
+}
+
+template< typename Easing >
+template< typename Float >
+constexpr Float tweeners::easing::ease_out_t< Easing >::operator()
+  ( Float t ) const
+{
+  return 1 - Easing()( 1 - t );
+}
+
+template< typename Easing >
+template< typename Float >
+constexpr Float tweeners::easing::ease_in_out_t< Easing >::operator()
+  ( Float t ) const
+{
+  // Same operations as ease_in_out(), such that the results are identical.
+  return ( t <= Float( 0.5 ) )
+    ? Easing()( 2 * t ) / 2
+    : Float( 0.5 ) + ( 1 - Easing()( 1 - ( 2 * t - 1 ) ) ) / 2;
+}
+
+template< typename Easing >
+template< typename Float >
+constexpr Float tweeners::easing::mirror< Easing >::operator()
+  ( Float t ) const
+{
+  return ( t <= Float( 0.5 ) ) ? Easing()( 2 * t ) : Easing()( 2 - 2 * t );
+}
+
+template< typename First, typename Second >
+template< typename Float >
+constexpr Float tweeners::easing::chain< First, Second >::operator()
+  ( Float t ) const
+{
+  return Second()( First()( t ) );
+}
+
+template< typename Easing, typename Ratio >
+template< typename Float >
+constexpr Float tweeners::easing::scale< Easing, Ratio >::operator()
+  ( Float t ) const
+{
+  return Float( Ratio::num ) / Float( Ratio::den ) * Easing()( t );
+}
+
+namespace tweeners
+{
+  namespace detail
+  {
+    template< typename Float >
+    constexpr Float clamp_unit( Float v )
+    {
+      return ( v < 0 ) ? Float( 0 ) : ( ( v > 1 ) ? Float( 1 ) : v );
+    }
+  }
+}
+
+template< typename Easing >
+template< typename Float >
+constexpr Float tweeners::easing::clamp< Easing >::operator()
+  ( Float t ) const
+{
+  return detail::clamp_unit( Easing()( t ) );
+}
+
+template< typename First, typename Second, typename Weight >
+template< typename Float >
+constexpr Float tweeners::easing::blend< First, Second, Weight >::operator()
+  ( Float t ) const
+{
+  return ( 1 - Float( Weight::num ) / Float( Weight::den ) ) * First()( t )
+    + Float( Weight::num ) / Float( Weight::den ) * Second()( t );
+}
+
+#define tweeners_easing_functor_id( f )                                 \
+  template<>                                                            \
+  struct has_easing_id< f ## _t >:                                      \
+    std::true_type                                                      \
+  {};                                                                   \
+                                                                        \
+  template<>                                                            \
+  struct easing_id_of< f ## _t >:                                       \
+    std::integral_constant< easing_id, easing_id::f >                   \
+  {}
+
+namespace tweeners
+{
+  namespace detail
+  {
+    /**
+     * \brief Tells if an easing identifier designates one of the ease-in
+     *        functions, i.e. has _out and _in_out variants.
+     */
+    constexpr bool is_ease_in_id( easing_id id )
+    {
+      return ( std::uint8_t( id ) >= std::uint8_t( easing_id::sine ) )
+        && ( ( std::uint8_t( id ) - std::uint8_t( easing_id::sine ) ) % 3
+             == 0 );
+    }
+
+    template
+    <
+      typename Easing,
+      bool HasId = easing::has_easing_id< Easing >::value
+    >
+    struct has_ease_in_id:
+      std::false_type
+    {};
+
+    template< typename Easing >
+    struct has_ease_in_id< Easing, true >:
+      std::integral_constant
+      < bool, is_ease_in_id( easing::easing_id_of< Easing >::value ) >
+    {};
+
+    /**
+     * \brief The identifier of the _out (Offset = 1) or _in_out (Offset = 2)
+     *        variant of Easing.
+     */
+    template< typename Easing, std::uint8_t Offset >
+    struct easing_id_variant:
+      std::integral_constant
+      <
+        easing_id,
+        easing_id
+        ( std::uint8_t( easing::easing_id_of< Easing >::value ) + Offset )
+      >
+    {};
+  }
+
+  namespace easing
+  {
+    tweeners_easing_functor_id( none );
+    tweeners_easing_functor_id( linear );
+    tweeners_easing_functor_id( sine );
+    tweeners_easing_functor_id( quad );
+    tweeners_easing_functor_id( cubic );
+    tweeners_easing_functor_id( quart );
+    tweeners_easing_functor_id( quint );
+    tweeners_easing_functor_id( circ );
+    tweeners_easing_functor_id( expo );
+    tweeners_easing_functor_id( elastic );
+    tweeners_easing_functor_id( bounce );
+    tweeners_easing_functor_id( back );
+
+    template< typename Easing >
+    struct has_easing_id< ease_out_t< Easing > >:
+      detail::has_ease_in_id< Easing >
+    {};
+
+    template< typename Easing >
+    struct easing_id_of< ease_out_t< Easing > >:
+      detail::easing_id_variant< Easing, 1 >
+    {};
+
+    template< typename Easing >
+    struct has_easing_id< ease_in_out_t< Easing > >:
+      detail::has_ease_in_id< Easing >
+    {};
+
+    template< typename Easing >
+    struct easing_id_of< ease_in_out_t< Easing > >:
+      detail::easing_id_variant< Easing, 2 >
+    {};
+  }
+}
+
+#undef tweeners_easing_functor_id
+
+#endif
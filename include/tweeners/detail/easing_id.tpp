@@ -0,0 +1,178 @@
+#ifndef TWEENERS_DETAIL_EASING_ID_TPP
+#define TWEENERS_DETAIL_EASING_ID_TPP
+
+#include <tweeners/contract.hpp>
+#include <tweeners/easing.hpp>
+
+#define tweeners_easing_functions( f )                                  \
+  &tweeners::easing::f< Float >,                                        \
+    &tweeners::easing::out< Float, &tweeners::easing::f< Float > >,     \
+    &tweeners::easing::in_out< Float, &tweeners::easing::f< Float > >
+
+#define tweeners_tabulated_easing( f )                                  \
+  &tweeners::easing::tabulated< Float, f, Resolution >
+
+#define tweeners_tabulated_easing_functions( f )                        \
+  tweeners_tabulated_easing( &tweeners::easing::f< Float > ),           \
+    tweeners_tabulated_easing                                           \
+    ( ( &tweeners::easing::out< Float, &tweeners::easing::f< Float > > ) ), \
+    tweeners_tabulated_easing                                           \
+    ( ( &tweeners::easing::in_out< Float, &tweeners::easing::f< Float > > ) )
+
+/**
+ * \brief Get the name of an easing function, as accepted by find_id().
+ */
+inline const char* tweeners::easing::name( easing_id id )
+{
+  static const char* const names[ id_count ] =
+    {
+      "none",
+      "linear",
+      "sine", "sine_out", "sine_in_out",
+      "quad", "quad_out", "quad_in_out",
+      "cubic", "cubic_out", "cubic_in_out",
+      "quart", "quart_out", "quart_in_out",
+      "quint", "quint_out", "quint_in_out",
+      "circ", "circ_out", "circ_in_out",
+      "expo", "expo_out", "expo_in_out",
+      "elastic", "elastic_out", "elastic_in_out",
+      "bounce", "bounce_out", "bounce_in_out",
+      "back", "back_out", "back_in_out"
+    };
+
+  const std::size_t index( static_cast< std::size_t >( id ) );
+
+  tweeners_confirm_contract
+    ( index < id_count, "easing::name(): unknown easing." );
+
+  return names[ index ];
+}
+
+/**
+ * \brief Get the identifier of an easing function from its name.
+ *
+ * \return false if there is no such function.
+ */
+inline bool tweeners::easing::find_id( const std::string& name, easing_id& id )
+{
+  for ( std::size_t i( 0 ); i != id_count; ++i )
+    if ( name == easing::name( static_cast< easing_id >( i ) ) )
+      {
+        id = static_cast< easing_id >( i );
+        return true;
+      }
+
+  return false;
+}
+
+/**
+ * \brief Get the easing function associated with an identifier.
+ */
+template< typename Float >
+Float ( *tweeners::easing::function( easing_id id ) )( Float )
+{
+  static Float ( * const functions[ id_count ] )( Float ) =
+    {
+      &easing::none< Float >,
+      &easing::linear< Float >,
+      tweeners_easing_functions( sine ),
+      tweeners_easing_functions( quad ),
+      tweeners_easing_functions( cubic ),
+      tweeners_easing_functions( quart ),
+      tweeners_easing_functions( quint ),
+      tweeners_easing_functions( circ ),
+      tweeners_easing_functions( expo ),
+      tweeners_easing_functions( elastic ),
+      tweeners_easing_functions( bounce ),
+      tweeners_easing_functions( back )
+    };
+
+  const std::size_t index( static_cast< std::size_t >( id ) );
+
+  tweeners_confirm_contract
+    ( index < id_count, "easing::function(): unknown easing." );
+
+  return functions[ index ];
+}
+
+/**
+ * \brief Get the approximation by easing::tabulated() of the easing function
+ *        associated with an identifier.
+ */
+template< typename Float, std::size_t Resolution >
+Float ( *tweeners::easing::tabulated_function( easing_id id ) )( Float )
+{
+  static Float ( * const functions[ id_count ] )( Float ) =
+    {
+      tweeners_tabulated_easing( &easing::none< Float > ),
+      tweeners_tabulated_easing( &easing::linear< Float > ),
+      tweeners_tabulated_easing_functions( sine ),
+      tweeners_tabulated_easing_functions( quad ),
+      tweeners_tabulated_easing_functions( cubic ),
+      tweeners_tabulated_easing_functions( quart ),
+      tweeners_tabulated_easing_functions( quint ),
+      tweeners_tabulated_easing_functions( circ ),
+      tweeners_tabulated_easing_functions( expo ),
+      tweeners_tabulated_easing_functions( elastic ),
+      tweeners_tabulated_easing_functions( bounce ),
+      tweeners_tabulated_easing_functions( back )
+    };
+
+  const std::size_t index( static_cast< std::size_t >( id ) );
+
+  tweeners_confirm_contract
+    ( index < id_count, "easing::tabulated_function(): unknown easing." );
+
+  return functions[ index ];
+}
+
+/**
+ * \brief Get the easing function associated with an identifier, using the
+ *        approximations easing::fast_sine(), easing::fast_circ(),
+ *        easing::fast_expo() and easing::fast_elastic() in place of the
+ *        functions calling the math library.
+ */
+template< typename Float >
+Float ( *tweeners::easing::fast_function( easing_id id ) )( Float )
+{
+  static Float ( * const functions[ id_count ] )( Float ) =
+    {
+      &easing::none< Float >,
+      &easing::linear< Float >,
+      tweeners_easing_functions( fast_sine ),
+      tweeners_easing_functions( quad ),
+      tweeners_easing_functions( cubic ),
+      tweeners_easing_functions( quart ),
+      tweeners_easing_functions( quint ),
+      tweeners_easing_functions( fast_circ ),
+      tweeners_easing_functions( fast_expo ),
+      tweeners_easing_functions( fast_elastic ),
+      tweeners_easing_functions( bounce ),
+      tweeners_easing_functions( back )
+    };
+
+  const std::size_t index( static_cast< std::size_t >( id ) );
+
+  tweeners_confirm_contract
+    ( index < id_count, "easing::fast_function(): unknown easing." );
+
+  return functions[ index ];
+}
+
+template< typename Float >
+Float ( *tweeners::easing::precise::function( easing_id id ) )( Float )
+{
+  return easing::function< Float >( id );
+}
+
+template< typename Float >
+Float ( *tweeners::easing::fast::function( easing_id id ) )( Float )
+{
+  return easing::fast_function< Float >( id );
+}
+
+#undef tweeners_tabulated_easing_functions
+#undef tweeners_tabulated_easing
+#undef tweeners_easing_functions
+
+#endif
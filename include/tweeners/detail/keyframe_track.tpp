@@ -0,0 +1,120 @@
+#ifndef TWEENERS_DETAIL_KEYFRAME_TRACK_TPP
+#define TWEENERS_DETAIL_KEYFRAME_TRACK_TPP
+
+#include <tweeners/contract.hpp>
+
+#include <algorithm>
+
+/**
+ * \brief Create a track from its keys.
+ *
+ * \param keys The values of the track, sorted by time. There must be at least
+ *        two keys and the last one must have a positive time. The easing of
+ *        the first key is not used.
+ *
+ * The track starts at time zero with the value of the first key, which is kept
+ * until the time of the first key.
+ */
+template< typename Float >
+tweeners::keyframe_track< Float >::keyframe_track
+( const std::vector< key >& keys )
+{
+  tweeners_confirm_contract
+    ( keys.size() >= 2, "keyframe_track: a track needs two keys." );
+
+  m_duration = keys.back().time;
+
+  tweeners_confirm_contract
+    ( m_duration > 0, "keyframe_track: the duration must be positive." );
+
+  m_segments.reserve( keys.size() - 1 );
+
+  for ( std::size_t i( 1 ); i != keys.size(); ++i )
+    {
+      const key& from( keys[ i - 1 ] );
+      const key& to( keys[ i ] );
+
+      tweeners_confirm_contract
+        ( from.time <= to.time, "keyframe_track: the keys are not sorted." );
+
+      segment s;
+      s.begin = from.time / m_duration;
+      s.transform = easing::function< Float >( to.easing );
+
+      // A segment of zero length is a jump to its final value.
+      if ( from.time == to.time )
+        {
+          s.inverse_length = 0;
+          s.from = to.value;
+          s.delta = 0;
+        }
+      else
+        {
+          s.inverse_length = m_duration / ( to.time - from.time );
+          s.from = from.value;
+          s.delta = to.value - from.value;
+        }
+
+      m_segments.push_back( s );
+    }
+}
+
+/**
+ * \brief Get the date of the last key.
+ */
+template< typename Float >
+Float tweeners::keyframe_track< Float >::duration() const
+{
+  return m_duration;
+}
+
+/**
+ * \brief Get the value of the track at a given ratio of its duration.
+ *
+ * \param ratio The date divided by duration().
+ * \param cursor The index of the segment found by the previous call, zero
+ *        initially. It is updated for the next call.
+ *
+ * The cost is constant when the ratio moves forward by less than a segment
+ * between two calls. If the ratio goes backward, for example when the slot
+ * restarts, the search begins again from the first segment.
+ */
+template< typename Float >
+Float tweeners::keyframe_track< Float >::value
+( Float ratio, std::size_t& cursor ) const
+{
+  const std::size_t last( m_segments.size() - 1 );
+
+  if ( ( cursor > last ) || ( ratio < m_segments[ cursor ].begin ) )
+    cursor = 0;
+
+  while ( ( cursor != last ) && ( m_segments[ cursor + 1 ].begin <= ratio ) )
+    ++cursor;
+
+  const segment& s( m_segments[ cursor ] );
+  const Float t
+    ( std::min
+      ( Float( 1 ),
+        std::max( Float( 0 ), ( ratio - s.begin ) * s.inverse_length ) ) );
+
+  return s.from + s.transform( t ) * s.delta;
+}
+
+template< typename Float, typename Update >
+tweeners::detail::keyframe_cursor< Float, Update >::keyframe_cursor
+( const keyframe_track< Float >& track, Update update )
+  : m_track( &track ),
+    m_update( std::move( update ) ),
+    m_cursor( 0 )
+{
+
+}
+
+template< typename Float, typename Update >
+void tweeners::detail::keyframe_cursor< Float, Update >::operator()
+( Float ratio )
+{
+  m_update( m_track->value( ratio, m_cursor ) );
+}
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef TWEENERS_DETAIL_PARAMETERIZED_EASING_TPP
+#define TWEENERS_DETAIL_PARAMETERIZED_EASING_TPP
+
+#include <tweeners/contract.hpp>
+#include <tweeners/easing.hpp>
+
+#include <cmath>
+
+/**
+ * \brief Create the linear easing, as the power of exponent one.
+ */
+template< typename Float >
+tweeners::parameterized_easing< Float >::parameterized_easing()
+  : parameterized_easing( parameterized_easing_id::power, 1 )
+{
+
+}
+
+/**
+ * \brief Create an easing of a given kind.
+ *
+ * \param id The kind of the easing.
+ * \param first The first parameter of the kind: the amplitude for elastic, the
+ *        overshoot for back, the number of steps for steps and the exponent
+ *        for power.
+ * \param second The second parameter of the kind: the period for elastic,
+ *        unused for the other kinds.
+ *
+ * The period of elastic and the exponent of power must be positive. The number
+ * of steps is rounded down and must be at least one.
+ */
+template< typename Float >
+tweeners::parameterized_easing< Float >::parameterized_easing
+( parameterized_easing_id id, Float first, Float second )
+  : m_id( id ),
+    m_parameters{ first, second, 0 }
+{
+  tweeners_confirm_contract
+    ( static_cast< std::size_t >( id ) < easing::parameterized_id_count,
+      "parameterized_easing: unknown easing." );
+
+  switch ( id )
+    {
+    case parameterized_easing_id::elastic:
+    case parameterized_easing_id::elastic_out:
+    case parameterized_easing_id::elastic_in_out:
+      tweeners_confirm_contract
+        ( second > 0, "parameterized_easing: the period must be positive." );
+      m_parameters[ 2 ] = detail::elastic_shift( first, second );
+      break;
+    case parameterized_easing_id::steps:
+      tweeners_confirm_contract
+        ( first >= 1, "parameterized_easing: there must be one step." );
+      m_parameters[ 0 ] = std::floor( first );
+      break;
+    case parameterized_easing_id::power:
+    case parameterized_easing_id::power_out:
+    case parameterized_easing_id::power_in_out:
+      tweeners_confirm_contract
+        ( first > 0, "parameterized_easing: the exponent must be positive." );
+      break;
+    default:
+      break;
+    }
+}
+
+template< typename Float >
+tweeners::parameterized_easing_id
+tweeners::parameterized_easing< Float >::id() const
+{
+  return m_id;
+}
+
+/**
+ * \brief The first parameter passed to the constructor, after rounding.
+ */
+template< typename Float >
+Float tweeners::parameterized_easing< Float >::first() const
+{
+  return m_parameters[ 0 ];
+}
+
+/**
+ * \brief The second parameter passed to the constructor.
+ */
+template< typename Float >
+Float tweeners::parameterized_easing< Float >::second() const
+{
+  return m_parameters[ 1 ];
+}
+
+template< typename Float >
+Float tweeners::parameterized_easing< Float >::operator()( Float t ) const
+{
+  const auto in
+    ( [ this ]( Float v ) -> Float
+      {
+        return ease_in( v );
+      } );
+
+  switch ( m_id )
+    {
+    case parameterized_easing_id::elastic_out:
+    case parameterized_easing_id::back_out:
+    case parameterized_easing_id::power_out:
+      return easing::ease_out( t, in );
+    case parameterized_easing_id::elastic_in_out:
+    case parameterized_easing_id::back_in_out:
+    case parameterized_easing_id::power_in_out:
+      return easing::ease_in_out( t, in );
+    default:
+      return ease_in( t );
+    }
+}
+
+/**
+ * \brief Evaluate the ease-in function of the kind of this easing.
+ */
+template< typename Float >
+Float tweeners::parameterized_easing< Float >::ease_in( Float t ) const
+{
+  switch ( m_id )
+    {
+    case parameterized_easing_id::elastic:
+    case parameterized_easing_id::elastic_out:
+    case parameterized_easing_id::elastic_in_out:
+      return detail::elastic_with_shift
+        ( t, m_parameters[ 0 ], m_parameters[ 1 ], m_parameters[ 2 ] );
+    case parameterized_easing_id::back:
+    case parameterized_easing_id::back_out:
+    case parameterized_easing_id::back_in_out:
+      return easing::back_with( t, m_parameters[ 0 ] );
+    case parameterized_easing_id::steps:
+      return easing::steps( t, m_parameters[ 0 ] );
+    default:
+      return easing::power( t, m_parameters[ 0 ] );
+    }
+}
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef TWEENERS_DETAIL_RANGE_LERP_HPP
+#define TWEENERS_DETAIL_RANGE_LERP_HPP
+
+#include <tweeners/vector_types.hpp>
+#include <tweeners/detail/config_traits.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace tweeners
+{
+  namespace detail
+  {
+    /**
+     * \brief Conversions between a multi-component value and the lanes in
+     *        which its components are interpolated. Not defined for the other
+     *        types.
+     *
+     * A specialization defines lane_type, the type of the components during
+     * the interpolation, lane_count, the number of components, and the
+     * static functions split() and merge() to convert from and to the value.
+     */
+    template< typename T >
+    struct channel_traits
+    {
+
+    };
+
+    template< typename Float >
+    struct channel_traits< vec2< Float > >
+    {
+      using lane_type = Float;
+      static constexpr std::size_t lane_count = 2;
+
+      static void split( const vec2< Float >& value, Float* lanes );
+      static vec2< Float > merge( const Float* lanes );
+    };
+
+    template< typename Float >
+    struct channel_traits< vec3< Float > >
+    {
+      using lane_type = Float;
+      static constexpr std::size_t lane_count = 3;
+
+      static void split( const vec3< Float >& value, Float* lanes );
+      static vec3< Float > merge( const Float* lanes );
+    };
+
+    template< typename Float >
+    struct channel_traits< vec4< Float > >
+    {
+      using lane_type = Float;
+      static constexpr std::size_t lane_count = 4;
+
+      static void split( const vec4< Float >& value, Float* lanes );
+      static vec4< Float > merge( const Float* lanes );
+    };
+
+    template<>
+    struct channel_traits< rgba8 >
+    {
+      using lane_type = float;
+      static constexpr std::size_t lane_count = 4;
+
+      static void split( const rgba8& value, float* lanes );
+      static rgba8 merge( const float* lanes );
+    };
+
+    /**
+     * \brief The interpolation of a value of type T from the ratio of the
+     *        duration of a slot, computed as from + ratio * ( to - from ).
+     */
+    template< typename T, typename Float, typename Enable = void >
+    class range_lerp
+    {
+    public:
+      /**
+       * \brief The type of the interpolated value, which is not T for the
+       *        integral types.
+       */
+      using result_type =
+        decltype
+        ( std::declval< T >()
+          + std::declval< Float >()
+          * ( std::declval< T >() - std::declval< T >() ) );
+
+    public:
+      range_lerp( T from, T to );
+
+      result_type operator()( Float ratio ) const;
+
+    private:
+      T m_from;
+      T m_to;
+    };
+
+    /**
+     * \brief The interpolation of a multi-component value.
+     *
+     * The components are stored in four lanes, padded with zeros, such that
+     * the compiler interpolates them with a single vector operation, and the
+     * value is built in a register before being returned.
+     */
+    template< typename T, typename Float >
+    class range_lerp
+    <
+      T, Float,
+      typename void_type< typename channel_traits< T >::lane_type >::type
+    >
+    {
+    public:
+      using result_type = T;
+
+    public:
+      range_lerp( T from, T to );
+
+      T operator()( Float ratio ) const;
+
+    private:
+      using traits = channel_traits< T >;
+      using lane_type = typename traits::lane_type;
+
+      static constexpr std::size_t lane_count = 4;
+
+    private:
+      lane_type m_from[ lane_count ];
+      lane_type m_delta[ lane_count ];
+    };
+  }
+}
+
+#include <tweeners/detail/range_lerp.tpp>
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef TWEENERS_DETAIL_RANGE_LERP_TPP
+#define TWEENERS_DETAIL_RANGE_LERP_TPP
+
+#include <algorithm>
+#include <utility>
+
+template< typename Float >
+void tweeners::detail::channel_traits< tweeners::vec2< Float > >::split
+( const vec2< Float >& value, Float* lanes )
+{
+  lanes[ 0 ] = value.x;
+  lanes[ 1 ] = value.y;
+}
+
+template< typename Float >
+tweeners::vec2< Float >
+tweeners::detail::channel_traits< tweeners::vec2< Float > >::merge
+( const Float* lanes )
+{
+  return vec2< Float >{ lanes[ 0 ], lanes[ 1 ] };
+}
+
+template< typename Float >
+void tweeners::detail::channel_traits< tweeners::vec3< Float > >::split
+( const vec3< Float >& value, Float* lanes )
+{
+  lanes[ 0 ] = value.x;
+  lanes[ 1 ] = value.y;
+  lanes[ 2 ] = value.z;
+}
+
+template< typename Float >
+tweeners::vec3< Float >
+tweeners::detail::channel_traits< tweeners::vec3< Float > >::merge
+( const Float* lanes )
+{
+  return vec3< Float >{ lanes[ 0 ], lanes[ 1 ], lanes[ 2 ] };
+}
+
+template< typename Float >
+void tweeners::detail::channel_traits< tweeners::vec4< Float > >::split
+( const vec4< Float >& value, Float* lanes )
+{
+  lanes[ 0 ] = value.x;
+  lanes[ 1 ] = value.y;
+  lanes[ 2 ] = value.z;
+  lanes[ 3 ] = value.w;
+}
+
+template< typename Float >
+tweeners::vec4< Float >
+tweeners::detail::channel_traits< tweeners::vec4< Float > >::merge
+( const Float* lanes )
+{
+  return vec4< Float >{ lanes[ 0 ], lanes[ 1 ], lanes[ 2 ], lanes[ 3 ] };
+}
+
+inline void tweeners::detail::channel_traits< tweeners::rgba8 >::split
+( const rgba8& value, float* lanes )
+{
+  lanes[ 0 ] = value.r;
+  lanes[ 1 ] = value.g;
+  lanes[ 2 ] = value.b;
+  lanes[ 3 ] = value.a;
+}
+
+/**
+ * \brief Round the channels to the nearest integer in [0, 255].
+ */
+inline tweeners::rgba8
+tweeners::detail::channel_traits< tweeners::rgba8 >::merge
+( const float* lanes )
+{
+  std::uint8_t channels[ 4 ];
+
+  for ( std::size_t i( 0 ); i != 4; ++i )
+    channels[ i ] = std::min( std::max( lanes[ i ], 0.f ), 255.f ) + 0.5f;
+
+  return rgba8{ channels[ 0 ], channels[ 1 ], channels[ 2 ], channels[ 3 ] };
+}
+
+template< typename T, typename Float, typename Enable >
+tweeners::detail::range_lerp< T, Float, Enable >::range_lerp( T from, T to )
+  : m_from( std::move( from ) ),
+    m_to( std::move( to ) )
+{
+
+}
+
+template< typename T, typename Float, typename Enable >
+typename tweeners::detail::range_lerp< T, Float, Enable >::result_type
+tweeners::detail::range_lerp< T, Float, Enable >::operator()
+( Float ratio ) const
+{
+  return m_from + ratio * ( m_to - m_from );
+}
+
+template< typename T, typename Float >
+tweeners::detail::range_lerp
+<
+  T, Float,
+  typename tweeners::detail::void_type
+  < typename tweeners::detail::channel_traits< T >::lane_type >::type
+>::range_lerp( T from, T to )
+  : m_from(),
+    m_delta()
+{
+  lane_type to_lanes[ lane_count ] = {};
+
+  traits::split( from, m_from );
+  traits::split( to, to_lanes );
+
+  for ( std::size_t i( 0 ); i != lane_count; ++i )
+    m_delta[ i ] = to_lanes[ i ] - m_from[ i ];
+}
+
+template< typename T, typename Float >
+T tweeners::detail::range_lerp
+<
+  T, Float,
+  typename tweeners::detail::void_type
+  < typename tweeners::detail::channel_traits< T >::lane_type >::type
+>::operator()( Float ratio ) const
+{
+  const lane_type r( ratio );
+  lane_type lanes[ lane_count ];
+
+  for ( std::size_t i( 0 ); i != lane_count; ++i )
+    lanes[ i ] = m_from[ i ] + r * m_delta[ i ];
+
+  return traits::merge( lanes );
+}
+
+#endif
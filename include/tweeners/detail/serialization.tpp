@@ -0,0 +1,51 @@
+#ifndef TWEENERS_DETAIL_SERIALIZATION_TPP
+#define TWEENERS_DETAIL_SERIALIZATION_TPP
+
+#include <tweeners/detail/system_serializer.hpp>
+
+/**
+ * \brief Write the state of the slots of a system in a binary stream.
+ *
+ * \param system The system to save.
+ * \param stream The stream receiving the data, opened in binary mode.
+ *
+ * The durations, the dates, the states, the sequences, the tags and the output
+ * bindings of the slots are saved, as well as the pending starts and removals.
+ * The functions of the slots are saved by name: each function of a slot must
+ * have a name given with system_base::set_slot_names(), except the
+ * transforms named after a built-in easing, which are saved by identifier.
+ *
+ * The targets of the slots, the user components and the coroutines waiting for
+ * the slots are not saved.
+ *
+ * The data is written in the byte order of the machine. It can be read only on
+ * a machine with the same byte order and the same configuration types.
+ */
+template< typename Config >
+void tweeners::save_system
+( const system_base< Config >& system, std::ostream& stream )
+{
+  detail::system_serializer< Config >::save( system, stream );
+}
+
+/**
+ * \brief Read the slots saved with save_system() in a system.
+ *
+ * \param system The system receiving the slots. It must not have any slot.
+ * \param stream The stream from which the data is read, opened in binary mode.
+ * \param callbacks The functions assigned to the slots, by name.
+ *
+ * The output buffers and the update groups used by the saved slots must have
+ * been created in \p system, in the same order than in the saved system. The
+ * slots keep their identifiers and continue their progression from their saved
+ * dates in the next update.
+ */
+template< typename Config >
+void tweeners::load_system
+( system_base< Config >& system, std::istream& stream,
+  const callback_registry_base< Config >& callbacks )
+{
+  detail::system_serializer< Config >::load( system, stream, callbacks );
+}
+
+#endif
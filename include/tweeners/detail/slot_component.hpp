@@ -1,6 +1,10 @@
 #ifndef TWEENERS_DETAIL_SLOT_COMPONENT_HPP
 #define TWEENERS_DETAIL_SLOT_COMPONENT_HPP
 
+#include <tweeners/span.hpp>
+
+#include <cstdint>
+#include <type_traits>
 #include <vector>
 
 namespace tweeners
@@ -20,6 +24,12 @@ namespace tweeners
      *
      * The slots whose component are stored in slot_component are expected to
      * be identified continuously from zero to n.
+     *
+     * The slots are grouped in pages of page_size entries. Each page has a
+     * bitset telling which of its slots have a value, and the storage for the
+     * indices of the values is allocated only for the pages where at least one
+     * slot has a value. Thus the slots without a value cost a single bit, plus
+     * the share of their page.
      */
     template< typename T, typename Id >
     class slot_component
@@ -30,10 +40,10 @@ namespace tweeners
       void reserve( std::size_t slot_count, std::size_t value_count );
 
       void add_one_slot_at_end();
-    
+
       template< typename... Args >
       void emplace( Id slot_id, Args&&... value );
-    
+
       bool has_value( Id slot_id ) const;
       T& get_existing( Id slot_id );
 
@@ -42,9 +52,51 @@ namespace tweeners
       template< typename Iterator >
       void erase( Iterator first, Iterator last );
 
+      span< T > values();
+      span< const Id > slots() const;
+
+    private:
+      /**
+       * \brief The type of the indices in m_values.
+       *
+       * There is at most one value per slot, plus the default value, thus an
+       * unsigned integer as large as Id can represent all of them.
+       */
+      using index_type = typename std::make_unsigned< Id >::type;
+
+      /** \brief The type of the bitset telling which slots have a value. */
+      using presence_type = std::uint64_t;
+
+      /**
+       * \brief The slots by groups of page_size, in the order of their
+       *        identifiers.
+       */
+      struct page
+      {
+        page();
+
+        /**
+         * \brief The bit i is set if and only if the i-th slot of the page has
+         *        a value.
+         */
+        presence_type presence;
+
+        /**
+         * \brief The index in m_values of the value associated with each slot
+         *        of the page.
+         *
+         * This vector is empty when presence is zero, otherwise it contains
+         * page_size entries. The entries for the slots having no associated
+         * value are meaningless.
+         */
+        std::vector< index_type > value_index;
+      };
+
+      static constexpr std::size_t page_size = 8 * sizeof( presence_type );
+
     private:
       void check_invariants() const;
-      
+
     private:
       /**
        * \brief The values asosciated with the slots.
@@ -53,20 +105,19 @@ namespace tweeners
        */
       std::vector< T > m_values;
 
-      /**
-       * \brief The index in m_values of the value associated with each slot.
-       *
-       * The slots having no associated value are assigned the index 0.
-       */
-      std::vector< std::size_t > m_value_index_from_slot;
+      /** \brief The pages of slots, indexed by slot_id / page_size. */
+      std::vector< page > m_pages;
 
       /**
-       * \brief Reverse lookup for m_value_index_from_slot.
+       * \brief Reverse lookup for the page's value_index.
        *
-       * Given i, the entry m_slot_from_value_index[ i ] is the index in
-       * m_value_index_from_slot to which is associated the value m_values[ i ].
+       * Given i, the entry m_slot_from_value_index[ i ] is the identifier of
+       * the slot to which is associated the value m_values[ i ].
        */
-      std::vector< std::size_t > m_slot_from_value_index;
+      std::vector< Id > m_slot_from_value_index;
+
+      /** \brief The number of slots added with add_one_slot_at_end(). */
+      std::size_t m_slot_count;
     };
   }
 }
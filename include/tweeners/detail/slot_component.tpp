@@ -7,11 +7,31 @@
   tweeners_debug_declare_scope_guard              \
   ( [ this ]() -> void { check_invariants(); } )
 
+#define tweeners_debug_validate_slot( id )                      \
+  do                                                            \
+    {                                                           \
+      tweeners_debug_assert( ( id ) >= 0 );                     \
+      tweeners_debug_assert                                     \
+        ( static_cast< std::size_t >( id ) < m_slot_count );    \
+    }                                                           \
+  while ( false )
+
+template< typename T, typename Id >
+constexpr std::size_t tweeners::detail::slot_component< T, Id >::page_size;
+
+template< typename T, typename Id >
+tweeners::detail::slot_component< T, Id >::page::page()
+  : presence( 0 )
+{
+
+}
+
 template< typename T, typename Id >
 tweeners::detail::slot_component< T, Id >::slot_component
 ( T default_value )
   : m_values( { std::move( default_value ) } ),
-    m_slot_from_value_index( { {} } )
+    m_slot_from_value_index( { {} } ),
+    m_slot_count( 0 )
 {
   tweeners_debug_slot_component_invariant();
 }
@@ -34,22 +54,25 @@ tweeners::detail::slot_component< T, Id >::reserve
   m_values.reserve( value_count );
   m_slot_from_value_index.reserve( value_count );
 
-  m_value_index_from_slot.reserve( slot_count );
+  m_pages.reserve( ( slot_count + page_size - 1 ) / page_size );
 }
 
 /**
  * \brief Add… one slot… at the container's… end.
  *
  * The The default value is assigned to the created entry. Conceptually this is
- * the value of the slot identified by the value m_value_index_from_slot.size()
- * just prior the call.
+ * the value of the slot identified by the value m_slot_count just prior the
+ * call.
  */
 template< typename T, typename Id >
 void tweeners::detail::slot_component< T, Id >::add_one_slot_at_end()
 {
   tweeners_debug_slot_component_invariant();
-  
-  m_value_index_from_slot.emplace_back( 0 );
+
+  if ( m_slot_count % page_size == 0 )
+    m_pages.emplace_back();
+
+  ++m_slot_count;
 }
 
 /**
@@ -60,6 +83,8 @@ void tweeners::detail::slot_component< T, Id >::add_one_slot_at_end()
  * \param value The arguments to pass to the constructor of `T` to construct the
  *        value assigned to slot_id.
  *
+ * If the slot already has a value, this value is replaced by the new one.
+ *
  * The storage for the slot must have been created with a prior call to
  * add_one_slot_at_end().
  */
@@ -69,16 +94,29 @@ void tweeners::detail::slot_component< T, Id >::emplace
 ( Id slot_id, Args&&... value )
 {
   tweeners_debug_slot_component_invariant();
+  tweeners_debug_validate_slot( slot_id );
 
-  tweeners_debug_assert( slot_id >= 0 );
-  tweeners_debug_assert( slot_id < m_value_index_from_slot.size() );
-  
-  const std::size_t value_index( m_values.size() );
+  page& p( m_pages[ slot_id / page_size ] );
+  const std::size_t offset( slot_id % page_size );
+  const presence_type bit( presence_type( 1 ) << offset );
+
+  if ( ( p.presence & bit ) != 0 )
+    {
+      m_values[ p.value_index[ offset ] ] =
+        T( std::forward< Args >( value )... );
+      return;
+    }
+
+  if ( p.presence == 0 )
+    p.value_index.resize( page_size );
+
+  const index_type value_index( static_cast< index_type >( m_values.size() ) );
 
   m_values.emplace_back( std::forward< Args >( value )... );
   m_slot_from_value_index.emplace_back( slot_id );
-  
-  m_value_index_from_slot[ slot_id ] = value_index;
+
+  p.value_index[ offset ] = value_index;
+  p.presence |= bit;
 }
 
 /**
@@ -95,11 +133,11 @@ template< typename T, typename Id >
 bool tweeners::detail::slot_component< T, Id >::has_value( Id slot_id ) const
 {
   tweeners_debug_slot_component_invariant();
-  
-  tweeners_debug_assert( slot_id >= 0 );
-  tweeners_debug_assert( slot_id < m_value_index_from_slot.size() );
+  tweeners_debug_validate_slot( slot_id );
 
-  return m_value_index_from_slot[ slot_id  ] != 0;
+  return
+    ( ( m_pages[ slot_id / page_size ].presence >> ( slot_id % page_size ) )
+      & 1 ) != 0;
 }
 
 /**
@@ -117,12 +155,12 @@ template< typename T, typename Id >
 T& tweeners::detail::slot_component< T, Id >::get_existing( Id slot_id )
 {
   tweeners_debug_slot_component_invariant();
-  
-  tweeners_debug_assert( slot_id >= 0 );
-  tweeners_debug_assert( slot_id < m_value_index_from_slot.size() );
-  tweeners_debug_assert( m_value_index_from_slot[ slot_id ] != 0 );
+  tweeners_debug_validate_slot( slot_id );
+  tweeners_debug_assert( has_value( slot_id ) );
 
-  return m_values[ m_value_index_from_slot[ slot_id  ] ];
+  return
+    m_values
+    [ m_pages[ slot_id / page_size ].value_index[ slot_id % page_size ] ];
 }
 
 /**
@@ -141,11 +179,15 @@ const T&
 tweeners::detail::slot_component< T, Id >::operator[]( Id slot_id ) const
 {
   tweeners_debug_slot_component_invariant();
+  tweeners_debug_validate_slot( slot_id );
+
+  const page& p( m_pages[ slot_id / page_size ] );
+  const std::size_t offset( slot_id % page_size );
 
-  tweeners_debug_assert( slot_id >= 0 );
-  tweeners_debug_assert( slot_id < m_value_index_from_slot.size() );
+  if ( ( ( p.presence >> offset ) & 1 ) == 0 )
+    return m_values[ 0 ];
 
-  return m_values[ m_value_index_from_slot[ slot_id ] ];
+  return m_values[ p.value_index[ offset ] ];
 }
 
 /**
@@ -153,7 +195,8 @@ tweeners::detail::slot_component< T, Id >::operator[]( Id slot_id ) const
  *        the given range.
  *
  * Non-default values of each slot id dereferenced by iterators in the range
- * [first, last) are destroyed then the default value is assigned to the slot. 
+ * [first, last) are destroyed then the default value is assigned to the slot.
+ * The storage of the pages left without any value is released.
  */
 template< typename T, typename Id >
 template< typename Iterator >
@@ -166,24 +209,29 @@ void tweeners::detail::slot_component< T, Id >::erase
 
   for ( ; first != last; ++first )
     {
-      tweeners_debug_assert( *first >= 0 );
-      tweeners_debug_assert( *first < m_value_index_from_slot.size() );
+      tweeners_debug_validate_slot( *first );
+
+      page& p( m_pages[ *first / page_size ] );
+      const std::size_t offset( *first % page_size );
+      const presence_type bit( presence_type( 1 ) << offset );
 
-      std::size_t& value_index( m_value_index_from_slot[ *first ] );
+      if ( ( p.presence & bit ) == 0 )
+        continue;
 
-      if ( value_index != 0 )
-        {
-          --values_size;
+      --values_size;
 
-          m_values[ value_index ] = std::move( m_values[ values_size ] );
+      const index_type value_index( p.value_index[ offset ] );
+      m_values[ value_index ] = std::move( m_values[ values_size ] );
 
-          const std::size_t moved_slot
-            ( m_slot_from_value_index[ values_size ] );
-          m_value_index_from_slot[ moved_slot ] = value_index;
-          m_slot_from_value_index[ value_index ] = moved_slot;
-          
-          value_index = 0;
-        }
+      const Id moved_slot( m_slot_from_value_index[ values_size ] );
+      m_pages[ moved_slot / page_size ].value_index[ moved_slot % page_size ] =
+        value_index;
+      m_slot_from_value_index[ value_index ] = moved_slot;
+
+      p.presence &= ~bit;
+
+      if ( p.presence == 0 )
+        std::vector< index_type >().swap( p.value_index );
     }
 
   m_values.erase( m_values.begin() + values_size, m_values.end() );
@@ -192,31 +240,81 @@ void tweeners::detail::slot_component< T, Id >::erase
       m_slot_from_value_index.end() );
 }
 
+/**
+ * \brief Return the non-default values, in no particular order.
+ *
+ * The i-th value is associated with the slot whose identifier is the i-th
+ * entry in slots(). The span is invalidated by the calls to emplace() and
+ * erase().
+ */
+template< typename T, typename Id >
+tweeners::span< T > tweeners::detail::slot_component< T, Id >::values()
+{
+  tweeners_debug_slot_component_invariant();
+
+  return span< T >( m_values.data() + 1, m_values.size() - 1 );
+}
+
+/**
+ * \brief Return the identifiers of the slots having a non-default value, in
+ *        the same order than values().
+ *
+ * The span is invalidated by the calls to emplace() and erase().
+ */
+template< typename T, typename Id >
+tweeners::span< const Id >
+tweeners::detail::slot_component< T, Id >::slots() const
+{
+  tweeners_debug_slot_component_invariant();
+
+  return
+    span< const Id >
+    ( m_slot_from_value_index.data() + 1, m_slot_from_value_index.size() - 1 );
+}
+
 template< typename T, typename Id >
 void tweeners::detail::slot_component< T, Id >::check_invariants() const
 {
   const std::size_t value_count( m_values.size() );
-  const std::size_t slot_count( m_value_index_from_slot.size() );
-  
+
   tweeners_debug_assert( value_count == m_slot_from_value_index.size() );
-  
-  for ( std::size_t slot( 0 ); slot != slot_count; ++slot )
+  tweeners_debug_assert
+    ( m_pages.size() == ( m_slot_count + page_size - 1 ) / page_size );
+
+  std::size_t slots_with_value( 0 );
+
+  for ( std::size_t slot( 0 ); slot != m_slot_count; ++slot )
     {
-      const std::size_t value_index( m_value_index_from_slot[ slot ] );
-      
-      tweeners_debug_assert( value_index < value_count );
+      const page& p( m_pages[ slot / page_size ] );
+      const std::size_t offset( slot % page_size );
+
+      tweeners_debug_assert
+        ( ( p.presence == 0 ) == p.value_index.empty() );
+
+      if ( ( ( p.presence >> offset ) & 1 ) == 0 )
+        continue;
+
+      ++slots_with_value;
 
+      const std::size_t value_index( p.value_index[ offset ] );
+
+      tweeners_debug_assert( value_index != 0 );
+      tweeners_debug_assert( value_index < value_count );
       tweeners_debug_assert
-        ( ( value_index == 0 )
-          || ( m_slot_from_value_index[ value_index ] == slot ) );
+        ( static_cast< std::size_t >( m_slot_from_value_index[ value_index ] )
+          == slot );
     }
 
+  tweeners_debug_assert( slots_with_value + 1 == value_count );
+
   for ( std::size_t value_index( 1 ); value_index != value_count;
         ++value_index )
     tweeners_debug_assert
-      ( m_slot_from_value_index[ value_index ] < slot_count );
+      ( static_cast< std::size_t >( m_slot_from_value_index[ value_index ] )
+        < m_slot_count );
 }
 
+#undef tweeners_debug_validate_slot
 #undef tweeners_debug_slot_component_invariant
 
 #endif
@@ -0,0 +1,83 @@
+#ifndef TWEENERS_DETAIL_SLOT_WAITERS_HPP
+#define TWEENERS_DETAIL_SLOT_WAITERS_HPP
+
+#include <tweeners/detail/slot_component.hpp>
+
+namespace tweeners
+{
+  namespace detail
+  {
+    /**
+     * \brief Something waiting for the completion of a slot, typically a
+     *        suspended coroutine.
+     *
+     * The waiters are linked in intrusive lists, thus waiting costs no
+     * allocation.
+     *
+     * \sa tweeners::slot_awaiter.
+     */
+    struct slot_waiter
+    {
+      /**
+       * \brief The function called when the slot completes or is removed,
+       *        with completed set to true or false respectively.
+       */
+      void ( *resume )( slot_waiter& self, bool completed );
+
+      /** \brief The next waiter in the list. */
+      slot_waiter* next;
+
+      /**
+       * \brief Tells if the waiter has been taken from the list of its slot
+       *        and is waiting to be resumed.
+       */
+      bool taken;
+    };
+
+    /**
+     * \brief The lists of waiters of the slots of a tweeners::system.
+     *
+     * The waiters are not copied with the lists: they are resumed only by the
+     * system in which they have been inserted.
+     */
+    template< typename Id >
+    class slot_waiters
+    {
+    public:
+      slot_waiters();
+      slot_waiters( const slot_waiters& that );
+
+      slot_waiters& operator=( const slot_waiters& that );
+
+      void add_one_slot_at_end();
+
+      void push( Id slot_id, slot_waiter& waiter );
+      void remove( Id slot_id, slot_waiter& waiter );
+
+      template< typename Iterator >
+      void take( Iterator first, Iterator last );
+
+      void resume_taken( bool completed );
+
+    private:
+      void remove_taken( slot_waiter& waiter );
+
+    private:
+      /** \brief The first waiter of each slot. */
+      slot_component< slot_waiter*, Id > m_first;
+
+      /**
+       * \brief The waiters removed from the lists of their slots by take(),
+       *        to be resumed by resume_taken().
+       */
+      slot_waiter* m_taken;
+
+      /** \brief The number of slots added with add_one_slot_at_end(). */
+      std::size_t m_slot_count;
+    };
+  }
+}
+
+#include <tweeners/detail/slot_waiters.tpp>
+
+#endif
@@ -0,0 +1,182 @@
+#ifndef TWEENERS_DETAIL_SLOT_WAITERS_TPP
+#define TWEENERS_DETAIL_SLOT_WAITERS_TPP
+
+#include <tweeners/detail/debug.hpp>
+
+template< typename Id >
+tweeners::detail::slot_waiters< Id >::slot_waiters()
+  : m_first( nullptr ),
+    m_taken( nullptr ),
+    m_slot_count( 0 )
+{
+
+}
+
+/**
+ * \brief Create the same number of slots than in \p that, without waiters.
+ */
+template< typename Id >
+tweeners::detail::slot_waiters< Id >::slot_waiters( const slot_waiters& that )
+  : slot_waiters()
+{
+  *this = that;
+}
+
+template< typename Id >
+tweeners::detail::slot_waiters< Id >&
+tweeners::detail::slot_waiters< Id >::operator=( const slot_waiters& that )
+{
+  m_first = slot_component< slot_waiter*, Id >( nullptr );
+  m_taken = nullptr;
+  m_slot_count = 0;
+
+  while ( m_slot_count != that.m_slot_count )
+    add_one_slot_at_end();
+
+  return *this;
+}
+
+template< typename Id >
+void tweeners::detail::slot_waiters< Id >::add_one_slot_at_end()
+{
+  m_first.add_one_slot_at_end();
+  ++m_slot_count;
+}
+
+/**
+ * \brief Append a waiter to the list of a slot.
+ */
+template< typename Id >
+void tweeners::detail::slot_waiters< Id >::push
+( Id slot_id, slot_waiter& waiter )
+{
+  waiter.next = nullptr;
+  waiter.taken = false;
+
+  if ( !m_first.has_value( slot_id ) )
+    {
+      m_first.emplace( slot_id, &waiter );
+      return;
+    }
+
+  slot_waiter* last( m_first.get_existing( slot_id ) );
+
+  while ( last->next != nullptr )
+    last = last->next;
+
+  last->next = &waiter;
+}
+
+/**
+ * \brief Remove a waiter from the list of a slot, or from the taken waiters,
+ *        without resuming it.
+ */
+template< typename Id >
+void tweeners::detail::slot_waiters< Id >::remove
+( Id slot_id, slot_waiter& waiter )
+{
+  if ( waiter.taken )
+    {
+      remove_taken( waiter );
+      return;
+    }
+
+  tweeners_debug_assert( m_first.has_value( slot_id ) );
+
+  slot_waiter*& first( m_first.get_existing( slot_id ) );
+
+  if ( first == &waiter )
+    {
+      if ( waiter.next == nullptr )
+        m_first.erase( &slot_id, &slot_id + 1 );
+      else
+        first = waiter.next;
+
+      return;
+    }
+
+  slot_waiter* previous( first );
+
+  while ( previous->next != &waiter )
+    {
+      tweeners_debug_assert( previous->next != nullptr );
+      previous = previous->next;
+    }
+
+  previous->next = waiter.next;
+}
+
+/**
+ * \brief Move the waiters of the slots represented in the range [first, last)
+ *        at the end of the taken waiters, ordered by slot then by insertion.
+ *
+ * The taken waiters can still be removed, for example when a coroutine is
+ * destroyed by a callback before being resumed.
+ */
+template< typename Id >
+template< typename Iterator >
+void
+tweeners::detail::slot_waiters< Id >::take( Iterator first, Iterator last )
+{
+  slot_waiter** tail( &m_taken );
+
+  while ( *tail != nullptr )
+    tail = &( *tail )->next;
+
+  bool found( false );
+
+  for ( Iterator it( first ); it != last; ++it )
+    if ( m_first.has_value( *it ) )
+      {
+        found = true;
+        *tail = m_first.get_existing( *it );
+
+        while ( *tail != nullptr )
+          {
+            ( *tail )->taken = true;
+            tail = &( *tail )->next;
+          }
+      }
+
+  if ( found )
+    m_first.erase( first, last );
+}
+
+/**
+ * \brief Call the resume function of the waiters moved by take().
+ */
+template< typename Id >
+void tweeners::detail::slot_waiters< Id >::resume_taken( bool completed )
+{
+  // Each waiter is unlinked before being resumed, such that the resume
+  // function can destroy any of the waiters, the next ones included.
+  while ( m_taken != nullptr )
+    {
+      slot_waiter& waiter( *m_taken );
+
+      m_taken = waiter.next;
+      waiter.next = nullptr;
+      waiter.taken = false;
+      waiter.resume( waiter, completed );
+    }
+}
+
+/**
+ * \brief Remove a waiter from the waiters moved by take().
+ */
+template< typename Id >
+void tweeners::detail::slot_waiters< Id >::remove_taken( slot_waiter& waiter )
+{
+  slot_waiter** link( &m_taken );
+
+  while ( *link != &waiter )
+    {
+      tweeners_debug_assert( *link != nullptr );
+      link = &( *link )->next;
+    }
+
+  *link = waiter.next;
+  waiter.taken = false;
+}
+
+#endif
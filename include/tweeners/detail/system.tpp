@@ -2,17 +2,22 @@
 #define TWEENERS_SYSTEM_TPP
 
 #include <tweeners/contract.hpp>
+#include <tweeners/easing_id.hpp>
 #include <tweeners/detail/debug.hpp>
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <exception>
 
 #define tweeners_debug_validate_id( id )                        \
   do                                                            \
     {                                                           \
       tweeners_debug_assert( ( id ) != not_an_id );             \
       tweeners_debug_assert( ( id ) >= 0 );                     \
-      tweeners_debug_assert( ( id ) < m_slot_states.size() );   \
+      tweeners_debug_assert                                     \
+        ( static_cast< std::size_t >( id )                      \
+          < m_slot_states.size() );                             \
     }                                                           \
   while ( false )
 
@@ -41,6 +46,38 @@ namespace tweeners
     {
       return value.count();
     }
+
+    /**
+     * \brief Build a duration from a number of its units, as the reverse of
+     *        to_float().
+     */
+    template< typename Duration >
+    struct duration_from_float
+    {
+      template< typename Float >
+      static Duration convert( Float value )
+      {
+        return Duration( value );
+      }
+    };
+
+    template< typename Rep, typename Period >
+    struct duration_from_float< std::chrono::duration< Rep, Period > >
+    {
+      template< typename Float >
+      static std::chrono::duration< Rep, Period > convert( Float value )
+      {
+        return
+          std::chrono::duration_cast< std::chrono::duration< Rep, Period > >
+          ( std::chrono::duration< Float, Period >( value ) );
+      }
+    };
+
+    template< typename Duration, typename Float >
+    Duration from_float( Float value )
+    {
+      return duration_from_float< Duration >::convert( value );
+    }
   }
 }
 
@@ -48,9 +85,24 @@ template< typename Config >
 tweeners::system_base< Config >::system_base()
   : m_start_functions( []() -> void {} ),
     m_done_functions( []() -> void {} ),
-    m_successors( {} )
+    m_successors( {} ),
+    m_tags( tag_type() ),
+    m_tag_indices( 0 ),
+    m_names( slot_names() ),
+    m_targets( nullptr ),
+    m_parameterized_easings( parameterized_easing< float_type >() ),
+    m_easings( easing_binding{ nullptr, easing_id() } ),
+    m_variables( variable_binding{ nullptr, 0, 0 } ),
+    m_outputs( output_binding() ),
+    m_output_snapshots( nullptr ),
+    m_structure_version( 0 ),
+    m_created_count( 0 ),
+    m_restored_version( 0 ),
+    m_restored_created_count( 0 )
 {
   tweeners_debug_system_invariant();
+
+  m_output_buffers.push_back( output_storage{ nullptr, 0, 1, {}, 0, 0, {} } );
 }
 
 /**
@@ -76,10 +128,21 @@ void tweeners::system_base< Config >::reserve
   m_slot_states.reserve( slot_count );
   m_slot.reserve( slot_count );
   m_current_dates.reserve( slot_count );
+  m_end_dates.reserve( slot_count );
+  m_paused.reserve( slot_count );
   
   m_start_functions.reserve( slot_count, value_count_per_component );
   m_done_functions.reserve( slot_count, value_count_per_component );
   m_successors.reserve( slot_count, value_count_per_component );
+  m_tags.reserve( slot_count, value_count_per_component );
+  m_tag_indices.reserve( slot_count, value_count_per_component );
+  m_names.reserve( slot_count, value_count_per_component );
+  m_targets.reserve( slot_count, value_count_per_component );
+  m_parameterized_easings.reserve( slot_count, value_count_per_component );
+  m_easings.reserve( slot_count, value_count_per_component );
+  m_variables.reserve( slot_count, value_count_per_component );
+  m_outputs.reserve( slot_count, value_count_per_component );
+  m_user_components.reserve( slot_count, value_count_per_component );
 
   m_start_queue.reserve( simultaneous_count );
   m_done_queue.reserve( simultaneous_count );
@@ -115,16 +178,55 @@ tweeners::system_base< Config >::configure_slot
   tweeners_debug_system_invariant();
 
   const id_type id( create_slot() );
+  initialize_slot
+    ( id, std::move( duration ), std::move( update ), std::move( transform ) );
 
-  tweener_state& tweener( m_slot[ id ] );
-  
-  tweener.end_date = duration;
-  tweener.previous = not_an_id;
-  tweener.on_update = std::move( update );
-  tweener.transform = std::move( transform );
+  return id;
+}
+
+/**
+ * \brief Configures a new slot whose transform is a built-in easing.
+ *
+ * \param easing The identifier of the easing, whose function is given by the
+ *        easing_precision of the configuration.
+ *
+ * The other parameters and the result are those of the other
+ * configure_slot(). The easing is called directly by the system, without going
+ * through a transform_function.
+ */
+template< typename Config >
+typename tweeners::system_base< Config >::id_type
+tweeners::system_base< Config >::configure_slot
+( duration_type duration, update_function update, easing_id easing )
+{
+  tweeners_debug_system_invariant();
+
+  const id_type id( create_slot() );
+  initialize_slot( id, std::move( duration ), std::move( update ), easing );
+
+  return id;
+}
+
+/**
+ * \brief Configures a new slot whose transform is a parameterized easing.
+ *
+ * \param easing The easing, stored by the system with the slot.
+ *
+ * The other parameters and the result are those of the other
+ * configure_slot(). As for the built-in easings, the easing is evaluated by
+ * the system without going through a transform_function.
+ */
+template< typename Config >
+typename tweeners::system_base< Config >::id_type
+tweeners::system_base< Config >::configure_slot
+( duration_type duration, update_function update,
+  const parameterized_easing< float_type >& easing )
+{
+  tweeners_debug_system_invariant();
+
+  const id_type id( create_slot() );
+  initialize_slot( id, std::move( duration ), std::move( update ), easing );
 
-  m_slot_states[ id ] = slot_state::ready;
-  
   return id;
 }
 
@@ -242,6 +344,15 @@ void tweeners::system_base< Config >::play_in_sequence
     ( is_valid_slot_id( second ),
       "system::play_in_sequence(): second slot does not exist." );
 
+  // A slot that is neither running nor scheduled to start can be sequenced
+  // without invalidating the timing snapshots: restoring them leaves it in a
+  // consistent state, either removed if it was configured since the snapshot
+  // or waiting for its new predecessor.
+  if ( ( m_slot_states[ second ] != slot_state::ready )
+       || ( std::find( m_start_queue.begin(), m_start_queue.end(), second )
+            != m_start_queue.end() ) )
+    change_structure();
+
   if ( !m_successors.has_value( first ) )
     m_successors.emplace( first );
 
@@ -277,57 +388,1164 @@ void tweeners::system_base< Config >::remove_slot( id_type slot_id )
 }
 
 /**
- * \brief Update the state of the system by moving the time forward for a given
- *        duration.
+ * \brief Suspend the progression of a slot.
  *
- * \param step The elapsed duration since the last update.
+ * \param slot_id The slot to pause.
  *
- * The update starts all slots that have been scheduled by the calls to
- * start_slots() since the previous update. Each running slot then moves forward
- * the given duration, triggering the update callback passed to
- * configure_slot(). If a slot reaches its end, its successors start and are
- * updated by the remaining amount of time not consumed by the slot. The done
- * and start callbacks are executed accordingly.
+ * A paused slot keeps its state but its date does not move forward and its
+ * update callback is not called until resume_slot() is called. If the slot is
+ * scheduled to start, it will still start (and its start callback will be
+ * called) but it will not progress.
  *
- * The tweeners existing in the system are considered late by the given duration
- * and are updated accordingly. Tweeners inserted during the update (e.g. in a
- * callback of an existing tweener) are not started during this update and are
- * postponed until the next.
+ * The dates of the running slots all move forward before the first update
+ * callback of an update is called. Thus if a slot is paused by the callback
+ * of another slot during an update, its callback is not called but its date
+ * has already moved forward for this update.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::pause_slot( id_type slot_id )
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( is_valid_slot_id( slot_id ),
+      "system::pause_slot(): slot does not exist." );
+
+  m_paused[ slot_id ] = 1;
+}
+
+/**
+ * \brief Let a slot paused with pause_slot() progress again.
  *
- * There is no guarantee on the order in which the slots are processed
- * relatively to each other.
+ * \param slot_id The slot to resume.
  */
 template< typename Config >
-void tweeners::system_base< Config >::update( duration_type step )
+void tweeners::system_base< Config >::resume_slot( id_type slot_id )
 {
-  // update_running_slots() may start new slots in sequences. These slots,
-  // and only them, must be updated during the same update call. Slots created
-  // in the callbacks of start_queued_slots() and stop_completed_slots() will
-  // wait until the next update.
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( is_valid_slot_id( slot_id ),
+      "system::resume_slot(): slot does not exist." );
+
+  m_paused[ slot_id ] = 0;
+}
 
+/**
+ * \brief Declare the variable updated by a slot, and resolve the conflicts with
+ *        the other slots updating the same variable.
+ *
+ * \param slot_id The slot updating the target.
+ *
+ * \param target The address of the variable updated by the slot.
+ *
+ * \param policy What to do if another slot, not completed yet, is already bound
+ *        to the same target.
+ *
+ * \return The slot after which slot_id must be played if policy is
+ *         overwrite_policy::queue_after and there is such a slot, not_an_id
+ *         otherwise. The caller is responsible for calling
+ *         play_in_sequence() or start_slot() accordingly.
+ *
+ * With overwrite_policy::replace_existing the existing slot is removed as if
+ * remove_slot() was called. A slot is unbound from its target when it
+ * completes or when it is removed. The cost of this function does not depend
+ * on the number of slots: it is an insertion in a hash map, from which the slot
+ * is erased when it is unbound. Thus only the slots whose conflicts must be
+ * resolved should be bound.
+ */
+template< typename Config >
+typename tweeners::system_base< Config >::id_type
+tweeners::system_base< Config >::bind_target
+( id_type slot_id, const void* target, overwrite_policy policy )
+{
   tweeners_debug_system_invariant();
 
-  remove_dead_slots();
-  
-  start_slots( m_start_queue );
-  update_current_date( step );
+  tweeners_confirm_contract
+    ( is_valid_slot_id( slot_id ),
+      "system::bind_target(): slot does not exist." );
+  tweeners_confirm_contract
+    ( !m_targets.has_value( slot_id ),
+      "system::bind_target(): slot is already bound to a target." );
 
-  bool done( false );
-  std::size_t update_from( 0 );
+  m_targets.emplace( slot_id, target );
 
-  while( !done )
-  {
-    update_running_slots( update_from );
-    stop_completed_slots();
+  const auto inserted( m_slot_from_target.emplace( target, slot_id ) );
 
-    if ( m_sequence_queue.empty() )
-      done = true;
-    else
+  if ( inserted.second )
+    return not_an_id;
+
+  id_type& bound_slot( inserted.first->second );
+  const id_type existing( bound_slot );
+  bound_slot = slot_id;
+
+  if ( m_slot_states[ existing ] == slot_state::dead )
+    return not_an_id;
+
+  switch ( policy )
+    {
+    case overwrite_policy::keep_both:
+      return not_an_id;
+    case overwrite_policy::replace_existing:
+      remove_slot( existing );
+      return not_an_id;
+    case overwrite_policy::queue_after:
+      return existing;
+    }
+
+  return not_an_id;
+}
+
+/**
+ * \brief Associate a key with a slot, such that all slots sharing the same key
+ *        can be processed together.
+ *
+ * \param slot_id The slot to tag.
+ * \param tag The key to associate with the slot, typically an identifier of the
+ *        entity owning the slot.
+ *
+ * A slot has at most one tag. If the slot already has a tag, it is replaced.
+ * The tag is removed along with the slot.
+ *
+ * \sa remove_tagged, pause_tagged, resume_tagged, for_each_tagged.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::tag_slot( id_type slot_id, tag_type tag )
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( is_valid_slot_id( slot_id ),
+      "system::tag_slot(): slot does not exist." );
+
+  if ( m_tags.has_value( slot_id ) )
+    {
+      if ( m_tags[ slot_id ] == tag )
+        return;
+
+      remove_from_tagged_slots( slot_id );
+    }
+
+  add_to_tagged_slots( slot_id, tag );
+}
+
+/**
+ * \brief Assign the names under which the functions of a slot are registered,
+ *        such that the slot can be saved with tweeners::save_system().
+ *
+ * The names replace the previous ones, if any. They are removed with the slot.
+ *
+ * \sa tweeners::callback_registry.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::set_slot_names
+( id_type slot_id, slot_names names )
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( is_valid_slot_id( slot_id ),
+      "system::set_slot_names(): slot does not exist." );
+
+  m_names.emplace( slot_id, std::move( names ) );
+}
+
+/**
+ * \brief Remove all the slots having a given tag.
+ *
+ * \param tag The tag of the slots to remove.
+ *
+ * This is equivalent to calling remove_slot() for each slot having the tag,
+ * with a cost proportional to the number of such slots.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::remove_tagged( tag_type tag )
+{
+  tweeners_debug_system_invariant();
+
+  const auto it( m_tagged_slots.find( tag ) );
+
+  if ( it == m_tagged_slots.end() )
+    return;
+
+  for ( id_type slot_id : it->second )
+    if ( m_slot_states[ slot_id ] != slot_state::dead )
+      remove_slot( slot_id );
+}
+
+/**
+ * \brief Pause all the slots having a given tag.
+ *
+ * \param tag The tag of the slots to pause.
+ *
+ * \sa pause_slot.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::pause_tagged( tag_type tag )
+{
+  tweeners_debug_system_invariant();
+
+  const auto it( m_tagged_slots.find( tag ) );
+
+  if ( it != m_tagged_slots.end() )
+    for ( id_type slot_id : it->second )
+      m_paused[ slot_id ] = 1;
+}
+
+/**
+ * \brief Resume all the slots having a given tag.
+ *
+ * \param tag The tag of the slots to resume.
+ *
+ * \sa resume_slot.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::resume_tagged( tag_type tag )
+{
+  tweeners_debug_system_invariant();
+
+  const auto it( m_tagged_slots.find( tag ) );
+
+  if ( it != m_tagged_slots.end() )
+    for ( id_type slot_id : it->second )
+      m_paused[ slot_id ] = 0;
+}
+
+/**
+ * \brief Call a function with the identifier of each slot having a given tag.
+ *
+ * \param tag The tag of the slots to visit.
+ * \param f The function to call, with a single id_type argument.
+ *
+ * The removed slots are not visited. The function can create slots with the
+ * same tag, in which case they are not visited, but it must not change the tag
+ * of the existing slots.
+ */
+template< typename Config >
+template< typename F >
+void tweeners::system_base< Config >::for_each_tagged
+( tag_type tag, F&& f ) const
+{
+  tweeners_debug_system_invariant();
+
+  const auto it( m_tagged_slots.find( tag ) );
+
+  if ( it == m_tagged_slots.end() )
+    return;
+
+  const std::vector< id_type >& slots( it->second );
+  const std::size_t count( slots.size() );
+
+  for ( std::size_t i( 0 ); i != count; ++i )
+    if ( m_slot_states[ slots[ i ] ] != slot_state::dead )
+      f( slots[ i ] );
+}
+
+/**
+ * \brief Create a new kind of value to associate with the slots.
+ *
+ * \param default_value The value of the component for the slots to which no
+ *        value has been assigned.
+ *
+ * \return A handle to pass to the other component functions of this system.
+ *
+ * The values of the component are stored densely, such that the slots without
+ * a specific value cost almost nothing. The value of a slot is destroyed when
+ * the slot is removed from the system.
+ *
+ * \sa set_component.
+ */
+template< typename Config >
+template< typename T >
+tweeners::component< T >
+tweeners::system_base< Config >::register_component( T default_value )
+{
+  tweeners_debug_system_invariant();
+
+  return
+    component< T >
+    ( m_user_components.add( std::move( default_value ), m_slot.size() ) );
+}
+
+/**
+ * \brief Assign a value of a user component to a given slot.
+ *
+ * \param c The component to which the value belongs, as returned by
+ *        register_component().
+ *
+ * \param slot_id The slot to which the value is associated.
+ *
+ * \param value The arguments to pass to the constructor of `T` to construct the
+ *        value.
+ *
+ * If the slot already has a value for this component, the value is replaced.
+ */
+template< typename Config >
+template< typename T, typename... Args >
+void tweeners::system_base< Config >::set_component
+( component< T > c, id_type slot_id, Args&&... value )
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( m_user_components.template has_type< T >( c.m_index ),
+      "system::set_component(): component does not exist." );
+  tweeners_confirm_contract
+    ( is_valid_slot_id( slot_id ),
+      "system::set_component(): slot does not exist." );
+
+  m_user_components.template get< T >( c.m_index ).emplace
+    ( slot_id, std::forward< Args >( value )... );
+}
+
+/**
+ * \brief Tell if a value has been assigned to a slot with set_component().
+ */
+template< typename Config >
+template< typename T >
+bool tweeners::system_base< Config >::has_component
+( component< T > c, id_type slot_id ) const
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( m_user_components.template has_type< T >( c.m_index ),
+      "system::has_component(): component does not exist." );
+  tweeners_confirm_contract
+    ( is_valid_slot_id( slot_id ),
+      "system::has_component(): slot does not exist." );
+
+  return m_user_components.template get< T >( c.m_index ).has_value( slot_id );
+}
+
+/**
+ * \brief Return the value of a component for a given slot.
+ *
+ * If no value has been assigned to the slot, the default value passed to
+ * register_component() is returned.
+ */
+template< typename Config >
+template< typename T >
+const T& tweeners::system_base< Config >::get_component
+( component< T > c, id_type slot_id ) const
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( m_user_components.template has_type< T >( c.m_index ),
+      "system::get_component(): component does not exist." );
+  tweeners_confirm_contract
+    ( is_valid_slot_id( slot_id ),
+      "system::get_component(): slot does not exist." );
+
+  return m_user_components.template get< T >( c.m_index )[ slot_id ];
+}
+
+/**
+ * \brief Return the values assigned to the slots for a given component, as a
+ *        contiguous range.
+ *
+ * The values are in no particular order. The i-th value is associated with the
+ * i-th slot in component_slots( c ). The span is invalidated by the calls to
+ * set_component() and update().
+ */
+template< typename Config >
+template< typename T >
+tweeners::span< T >
+tweeners::system_base< Config >::component_values( component< T > c )
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( m_user_components.template has_type< T >( c.m_index ),
+      "system::component_values(): component does not exist." );
+
+  return m_user_components.template get< T >( c.m_index ).values();
+}
+
+/**
+ * \brief Return the slots having a value for a given component, in the same
+ *        order than component_values().
+ *
+ * The span is invalidated by the calls to set_component() and update().
+ */
+template< typename Config >
+template< typename T >
+tweeners::span< const typename tweeners::system_base< Config >::id_type >
+tweeners::system_base< Config >::component_slots( component< T > c ) const
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( m_user_components.template has_type< T >( c.m_index ),
+      "system::component_slots(): component does not exist." );
+
+  return m_user_components.template get< T >( c.m_index ).slots();
+}
+
+/**
+ * \brief Declare an array receiving the values of the slots bound to it with
+ *        bind_output().
+ *
+ * \param values The first entry of the array.
+ * \param count The number of entries in the array.
+ * \param stride The distance between two consecutive entries, in float_type
+ *        units, e.g. the number of floats in a vertex.
+ *
+ * \return A handle to pass to bind_output() and dirty_ranges().
+ *
+ * The entry i of the array is values[ i * stride ]. The array must outlive the
+ * system or its slots bound to it.
+ */
+template< typename Config >
+tweeners::output_buffer tweeners::system_base< Config >::add_output_buffer
+( float_type* values, std::size_t count, std::size_t stride )
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( ( values != nullptr ) || ( count == 0 ),
+      "system::add_output_buffer(): values is null." );
+  tweeners_confirm_contract
+    ( stride != 0, "system::add_output_buffer(): stride is zero." );
+
+  m_output_buffers.push_back
+    ( output_storage
+      { values, count, stride,
+        std::vector< std::uint64_t >( ( count + 63 ) / 64 ), 0, 0, {} } );
+
+  return output_buffer( m_output_buffers.size() - 1 );
+}
+
+/**
+ * \brief Assign the values of a slot to a variable, without update function.
+ *
+ * \param slot_id The slot.
+ * \param from The value assigned when the slot starts.
+ * \param to The value assigned when the slot ends.
+ * \param variable The variable receiving the values. It must outlive the slot.
+ *
+ * The system assigns the variable itself, thus the update function and the
+ * output of the slot are not used. A slot bound to a variable cannot be saved
+ * with save_system().
+ */
+template< typename Config >
+void tweeners::system_base< Config >::bind_variable
+( id_type slot_id, float_type from, float_type to, float_type& variable )
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( is_valid_slot_id( slot_id ),
+      "system::bind_variable(): slot does not exist." );
+
+  m_variables.emplace( slot_id, variable_binding{ &variable, from, to } );
+}
+
+/**
+ * \brief Write the values of a slot in the buffer owned by the system, at the
+ *        index of the slot.
+ *
+ * \sa output_values.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::bind_output
+( id_type slot_id, float_type from, float_type to )
+{
+  bind_output( slot_id, from, to, output_buffer(), slot_id );
+}
+
+/**
+ * \brief Write the values of a slot in an entry of an output buffer instead of
+ *        passing them to its update callback.
+ *
+ * \param slot_id The slot whose values are written.
+ * \param from The value written when the slot starts.
+ * \param to The value written when the slot ends.
+ * \param buffer The buffer receiving the values, as returned by
+ *        add_output_buffer(), or output_buffer() for the buffer owned by the
+ *        system.
+ * \param index The entry of the buffer receiving the values.
+ *
+ * The update callback of the slot is not called anymore, it can then be
+ * empty. The binding is removed with the slot.
+ *
+ * The entries written during an update are listed by dirty_ranges().
+ */
+template< typename Config >
+void tweeners::system_base< Config >::bind_output
+( id_type slot_id, float_type from, float_type to, output_buffer buffer,
+  std::size_t index )
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( is_valid_slot_id( slot_id ),
+      "system::bind_output(): slot does not exist." );
+  tweeners_confirm_contract
+    ( buffer.m_index < m_output_buffers.size(),
+      "system::bind_output(): buffer does not exist." );
+  tweeners_confirm_contract
+    ( index
+      < ( ( buffer.m_index == 0 )
+          ? m_slot_states.size()
+          : m_output_buffers[ buffer.m_index ].count ),
+      "system::bind_output(): index is out of the buffer." );
+
+  emplace_output
+    ( slot_id, output_binding{ from, to, buffer.m_index, index, false } );
+}
+
+/**
+ * \brief Get the buffer owned by the system, where the value of a slot bound
+ *        with bind_output( slot_id, from, to ) is at index slot_id.
+ *
+ * The buffer has no storage for the slots without output: it ends after the
+ * largest index bound to it. The span is invalidated by the next binding to
+ * this buffer.
+ */
+template< typename Config >
+tweeners::span< const typename tweeners::system_base< Config >::float_type >
+tweeners::system_base< Config >::output_values() const
+{
+  return
+    span< const float_type >( m_output_values.data(), m_output_values.size() );
+}
+
+/**
+ * \brief Get the entries of an output buffer written during the last update,
+ *        as sorted and disjoint ranges.
+ *
+ * \param buffer The buffer, as returned by add_output_buffer(), or
+ *        output_buffer() for the buffer owned by the system.
+ */
+template< typename Config >
+tweeners::span< const tweeners::output_range >
+tweeners::system_base< Config >::dirty_ranges( output_buffer buffer ) const
+{
+  tweeners_confirm_contract
+    ( buffer.m_index < m_output_buffers.size(),
+      "system::dirty_ranges(): buffer does not exist." );
+
+  const std::vector< output_range >& dirty
+    ( m_output_buffers[ buffer.m_index ].dirty );
+
+  return span< const output_range >( dirty.data(), dirty.size() );
+}
+
+/**
+ * \brief Publish a copy of output_values() at the end of each update.
+ *
+ * \param snapshots Where the copies are published, or nullptr to stop the
+ *        publication.
+ *
+ * This allows another thread to read the values of the slots bound with
+ * bind_output( slot_id, from, to ) via snapshots->acquire_latest(), without
+ * locking. The reader never sees the values of an update in progress.
+ *
+ * The snapshots must outlive the system or the next call to this function.
+ * They must be written by a single system.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::publish_outputs
+( output_snapshots* snapshots )
+{
+  m_output_snapshots = snapshots;
+}
+
+/**
+ * \brief Create a callback receiving the values of all the slots bound to it
+ *        with bind_group(), in a single call.
+ *
+ * \param callback The function receiving the values. It is called once per
+ *        update if any slot of the group has progressed, before the done
+ *        callbacks of the slots completed during the update.
+ *
+ * \return A handle to pass to bind_group().
+ *
+ * The values are passed in no particular order.
+ *
+ * The slots started in sequence during an update, after the completion of
+ * their predecessor, are updated in another pass, after the done callbacks
+ * of the predecessors. The callback is then called again with the values of
+ * these slots, thus once per pass rather than once per update.
+ */
+template< typename Config >
+tweeners::update_group tweeners::system_base< Config >::register_update_group
+( group_function callback )
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( callback, "system::register_update_group(): callback is not valid." );
+
+  m_update_groups.push_back( group_storage{ std::move( callback ), {} } );
+
+  return update_group( m_update_groups.size() - 1 );
+}
+
+/**
+ * \brief Pass the values of a slot to the callback of a group, with the
+ *        identifier of the slot as the key.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::bind_group
+( id_type slot_id, float_type from, float_type to, update_group group )
+{
+  bind_group( slot_id, from, to, group, slot_id );
+}
+
+/**
+ * \brief Pass the values of a slot to the callback of a group instead of its
+ *        update callback.
+ *
+ * \param slot_id The slot whose values are passed to the group.
+ * \param from The value passed when the slot starts.
+ * \param to The value passed when the slot ends.
+ * \param group The group receiving the values, as returned by
+ *        register_update_group().
+ * \param key The value identifying the slot in the callback of the group,
+ *        e.g. the index of the object updated by the slot.
+ *
+ * The update callback of the slot is not called anymore, it can then be
+ * empty. A slot is either bound to a group or to an output buffer, the last
+ * binding replacing the previous one. The binding is removed with the slot.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::bind_group
+( id_type slot_id, float_type from, float_type to, update_group group,
+  std::size_t key )
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( is_valid_slot_id( slot_id ),
+      "system::bind_group(): slot does not exist." );
+  tweeners_confirm_contract
+    ( group.m_index < m_update_groups.size(),
+      "system::bind_group(): group does not exist." );
+
+  emplace_output
+    ( slot_id, output_binding{ from, to, group.m_index, key, true } );
+}
+
+template< typename Config >
+tweeners::system_base< Config >::timing_snapshot::timing_snapshot()
+  : m_system( nullptr ),
+    m_structure_version( 0 ),
+    m_created_count( 0 ),
+    m_slot_count( 0 ),
+    m_queue_sizes{ 0, 0, 0, 0, 0 }
+{
+
+}
+
+/**
+ * \brief Get the state of a slot when the snapshot was taken.
+ *
+ * \param slot_id The slot, lower than m_slot_count.
+ */
+template< typename Config >
+typename tweeners::system_base< Config >::slot_state
+tweeners::system_base< Config >::timing_snapshot::saved_state
+( std::size_t slot_id ) const
+{
+  slot_state result;
+  read( m_data.data() + slot_id * sizeof( slot_state ), &result, 1 );
+
+  return result;
+}
+
+/**
+ * \brief Copy an array of values at a given position in the data.
+ *
+ * \return The position following the copied values.
+ */
+template< typename Config >
+template< typename T >
+char* tweeners::system_base< Config >::timing_snapshot::write
+( char* out, const T* values, std::size_t count )
+{
+  if ( count == 0 )
+    return out;
+
+  std::memcpy( out, values, count * sizeof( T ) );
+  return out + count * sizeof( T );
+}
+
+/**
+ * \brief Copy an array of values from a given position in the data.
+ *
+ * \return The position following the copied values.
+ */
+template< typename Config >
+template< typename T >
+const char* tweeners::system_base< Config >::timing_snapshot::read
+( const char* in, T* values, std::size_t count )
+{
+  if ( count == 0 )
+    return in;
+
+  std::memcpy( values, in, count * sizeof( T ) );
+  return in + count * sizeof( T );
+}
+
+/**
+ * \brief Save the progression of the slots, to be restored later with
+ *        restore_timing().
+ *
+ * \param snapshot Receives the state of the slots, their dates and the
+ *        scheduled starts and removals. Its storage is reused.
+ *
+ * The callbacks, transforms, components and outputs of the slots are not
+ * saved: they are kept as is by restore_timing(), which is valid as long as
+ * none of the slots of the snapshot is removed or sequenced.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::save_timing
+( timing_snapshot& snapshot ) const
+{
+  tweeners_debug_system_invariant();
+
+  const std::size_t slot_count( m_slot_states.size() );
+  const std::vector< id_type >* const queues[] =
+    { &m_start_queue, &m_done_queue, &m_dead_queue, &m_sequence_queue,
+      &m_need_update };
+  std::size_t queued_count( 0 );
+
+  for ( std::size_t i( 0 ); i != 5; ++i )
+    {
+      snapshot.m_queue_sizes[ i ] = queues[ i ]->size();
+      queued_count += queues[ i ]->size();
+    }
+
+  snapshot.m_system = this;
+  snapshot.m_structure_version = m_structure_version;
+  snapshot.m_created_count = m_created_count;
+  snapshot.m_slot_count = slot_count;
+  snapshot.m_data.resize
+    ( slot_count
+      * ( sizeof( slot_state ) + sizeof( std::uint8_t )
+          + sizeof( duration_type ) )
+      + queued_count * sizeof( id_type ) );
+
+  char* out( snapshot.m_data.data() );
+  out = timing_snapshot::write( out, m_slot_states.data(), slot_count );
+  out = timing_snapshot::write( out, m_paused.data(), slot_count );
+  out = timing_snapshot::write( out, m_current_dates.data(), slot_count );
+
+  for ( const std::vector< id_type >* queue : queues )
+    out = timing_snapshot::write( out, queue->data(), queue->size() );
+}
+
+/**
+ * \brief Set the progression of the slots back to the state saved by
+ *        save_timing().
+ *
+ * \param snapshot A snapshot of this system. None of its slots must have been
+ *        released since then, neither by an update following a call to
+ *        remove_slot() nor by a load, and none of its running or scheduled
+ *        slots must have been sequenced since then. Thus a snapshot taken
+ *        before remove_slot() can be restored until the next update.
+ *
+ * The validity of the snapshot is checked from a single version of the
+ * structure of the system, thus the snapshot is rejected if any slot has been
+ * released or sequenced as described above, even if the slot was created
+ * after the snapshot. Restoring a snapshot keeps it valid, as well as the
+ * snapshots taken before it with the same version, and invalidates the ones
+ * taken after it if it removes slots.
+ *
+ * The slots created since the snapshot are removed, as if they never existed:
+ * their done callbacks are not called and the coroutines waiting for them are
+ * resumed with a failure. No other callback is called. The slots bound to a
+ * target with bind_target() and completed since the snapshot are not bound
+ * anymore, and the output buffers keep their values until the next update.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::restore_timing
+( const timing_snapshot& snapshot )
+{
+  tweeners_debug_system_invariant();
+
+  tweeners_confirm_contract
+    ( snapshot.m_system == this,
+      "system::restore_timing(): snapshot is not from this system." );
+  tweeners_confirm_contract
+    ( ( snapshot.m_structure_version == m_structure_version )
+      || ( ( snapshot.m_structure_version == m_restored_version )
+           && ( snapshot.m_created_count <= m_restored_created_count ) ),
+      "system::restore_timing(): slots have been removed or sequenced since"
+      " the snapshot." );
+
+  const std::size_t slot_count( snapshot.m_slot_count );
+  tweeners_debug_assert( slot_count <= m_slot_states.size() );
+
+  const bool removed( remove_slots_created_since( snapshot ) );
+
+  const char* in( snapshot.m_data.data() );
+  in = timing_snapshot::read( in, m_slot_states.data(), slot_count );
+  in = timing_snapshot::read( in, m_paused.data(), slot_count );
+  in = timing_snapshot::read( in, m_current_dates.data(), slot_count );
+
+  std::vector< id_type >* const queues[] =
+    { &m_start_queue, &m_done_queue, &m_dead_queue, &m_sequence_queue,
+      &m_need_update };
+
+  for ( std::size_t i( 0 ); i != 5; ++i )
+    {
+      queues[ i ]->resize( snapshot.m_queue_sizes[ i ] );
+      in =
+        timing_snapshot::read
+        ( in, queues[ i ]->data(), snapshot.m_queue_sizes[ i ] );
+    }
+
+  // The available identifiers are left as is: the slots of the snapshot have
+  // not been released since then, and the ones created since have been
+  // released above. The identifiers given to the command buffers since the
+  // snapshot must not be made available again.
+
+  if ( removed )
+    {
+      const std::uint64_t version( snapshot.m_structure_version );
+      const std::uint64_t created_count( snapshot.m_created_count );
+
+      change_structure();
+      m_restored_version = version;
+      m_restored_created_count = created_count;
+    }
+
+  m_waiters.resume_taken( false );
+}
+
+/**
+ * \brief Release the slots configured since a given snapshot, without
+ *        resuming the coroutines waiting for them.
+ *
+ * \param snapshot The snapshot passed to restore_timing().
+ *
+ * \return true if some slots were released.
+ */
+template< typename Config >
+bool tweeners::system_base< Config >::remove_slots_created_since
+( const timing_snapshot& snapshot )
+{
+  if ( snapshot.m_created_count == m_created_count )
+    return false;
+
+  const std::size_t saved_count( snapshot.m_slot_count );
+  const std::size_t slot_count( m_slot_states.size() );
+
+  m_dead_queue.clear();
+
+  for ( std::size_t i( 0 ); i != slot_count; ++i )
+    if ( ( m_slot_states[ i ] != slot_state::available )
+         && ( ( i >= saved_count )
+              || ( snapshot.saved_state( i ) == slot_state::available ) ) )
+      {
+        m_slot_states[ i ] = slot_state::dead;
+        m_dead_queue.push_back( static_cast< id_type >( i ) );
+      }
+
+  if ( m_dead_queue.empty() )
+    return false;
+
+  release_dead_slots();
+  return true;
+}
+
+/**
+ * \brief Invalidate the timing snapshots taken before a change in the slots
+ *        that they cannot restore.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::change_structure()
+{
+  ++m_structure_version;
+  m_restored_version = m_structure_version;
+  m_restored_created_count = m_created_count;
+}
+
+/**
+ * \brief Get the number of slots that will be updated in the next update.
+ */
+template< typename Config >
+std::size_t tweeners::system_base< Config >::running_count() const
+{
+  return m_need_update.size();
+}
+
+/**
+ * \brief Update the state of the system by moving the time forward for a given
+ *        duration.
+ *
+ * \param step The elapsed duration since the last update.
+ *
+ * The update starts all slots that have been scheduled by the calls to
+ * start_slots() since the previous update. Each running slot then moves forward
+ * the given duration, triggering the update callback passed to
+ * configure_slot(). If a slot reaches its end, its successors start and are
+ * updated by the remaining amount of time not consumed by the slot. The done
+ * and start callbacks are executed accordingly.
+ *
+ * The tweeners existing in the system are considered late by the given duration
+ * and are updated accordingly. Tweeners inserted during the update (e.g. in a
+ * callback of an existing tweener) are not started during this update and are
+ * postponed until the next.
+ *
+ * There is no guarantee on the order in which the slots are processed
+ * relatively to each other. The dates of all the running slots move forward
+ * before any update callback is called, thus the changes made by a callback
+ * to the other slots, like pausing them, apply to their dates from the next
+ * update only.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::update( duration_type step )
+{
+  // update_running_slots() may start new slots in sequences. These slots,
+  // and only them, must be updated during the same update call. Slots created
+  // in the callbacks of start_queued_slots() and stop_completed_slots() will
+  // wait until the next update.
+
+  tweeners_debug_system_invariant();
+
+  reset_output_buffers();
+  apply_commands();
+  remove_dead_slots();
+  
+  start_slots( m_start_queue );
+
+  bool done( false );
+  id_type update_from( 0 );
+
+  // The slots started in sequence have received their date from their
+  // predecessor, thus the step is applied to the first pass only.
+  duration_type elapsed( step );
+
+  while( !done )
+  {
+    update_running_slots( update_from, elapsed );
+    stop_completed_slots( update_from );
+
+    if ( m_sequence_queue.empty() )
+      done = true;
+    else
+      {
+        update_from = static_cast< id_type >( m_need_update.size() );
+        elapsed = duration_type();
+        start_slots( m_sequence_queue );
+      }
+  }
+
+  collect_dirty_ranges();
+  publish_output_snapshot();
+}
+
+/**
+ * \brief Execute the commands submitted with command_buffer_base since the
+ *        previous update.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::apply_commands()
+{
+  using batch = detail::command_batch< Config >;
+
+  batch* const batches( m_commands.pop_all() );
+
+  // The identifiers given to the buffers and not used by them.
+  for ( batch* b( batches ); b != nullptr; b = b->next )
+    {
+      m_available_ids.insert
+        ( m_available_ids.end(), b->free_ids.begin(), b->free_ids.end() );
+      b->free_ids.clear();
+    }
+
+  // A failing command does not prevent the application of the next ones,
+  // otherwise the identifiers reserved for their slots would be lost. The
+  // first error is reported once all the commands have been processed.
+  std::exception_ptr error;
+
+  for ( batch* b( batches ); b != nullptr; b = b->next )
+    for ( const typename batch::command& c : b->commands )
+      try
+        {
+          apply_command( *b, c );
+        }
+      catch( ... )
+        {
+          if ( !error )
+            error = std::current_exception();
+
+          discard_failed_command( batches, c );
+        }
+
+  // Each buffer receives as many identifiers as it has configured slots, in
+  // anticipation of its next submission.
+  for ( batch* b( batches ); b != nullptr; b = b->next )
+    {
+      const std::size_t count
+        ( std::min( b->configure_count(), m_available_ids.size() ) );
+
+      b->free_ids.assign
+        ( m_available_ids.end() - count, m_available_ids.end() );
+      m_available_ids.resize( m_available_ids.size() - count );
+    }
+
+  m_commands.recycle( batches );
+
+  if ( error )
+    std::rethrow_exception( error );
+}
+
+/**
+ * \brief Cancel the slot of a command that could not be applied, if the slot
+ *        was configured by the submitted commands.
+ *
+ * \param batches The commands being applied.
+ * \param c The command that failed.
+ *
+ * If the configuration itself failed, the identifier of the slot is made
+ * available again. Otherwise the slot is removed, such that it is not left
+ * configured but never started. The slots created by other means are left
+ * untouched.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::discard_failed_command
+( const detail::command_batch< Config >* batches,
+  const typename detail::command_batch< Config >::command& c )
+{
+  using batch = detail::command_batch< Config >;
+
+  if ( batch::is_configure( c.what ) )
+    {
+      grow_slots( static_cast< std::size_t >( c.slot ) + 1 );
+
+      if ( m_slot_states[ c.slot ] == slot_state::available )
+        m_available_ids.emplace_back( c.slot );
+
+      return;
+    }
+
+  if ( !is_valid_slot_id( c.slot )
+       || ( m_slot_states[ c.slot ] == slot_state::dead ) )
+    return;
+
+  for ( const batch* b( batches ); b != nullptr; b = b->next )
+    for ( const typename batch::command& configure : b->commands )
+      if ( batch::is_configure( configure.what )
+           && ( configure.slot == c.slot ) )
+        {
+          remove_slot( c.slot );
+          return;
+        }
+}
+
+/**
+ * \brief Execute a command of a batch.
+ *
+ * \param b The batch containing the command, from which the arguments are
+ *        moved.
+ * \param c The command to execute.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::apply_command
+( detail::command_batch< Config >& b,
+  const typename detail::command_batch< Config >::command& c )
+{
+  using kind = typename detail::command_batch< Config >::kind;
+
+  switch ( c.what )
+    {
+    case kind::configure:
+      {
+        auto& arguments( b.configures[ c.arguments ] );
+
+        grow_slots( static_cast< std::size_t >( c.slot ) + 1 );
+        initialize_slot
+          ( c.slot, std::move( arguments.duration ),
+            std::move( arguments.update ), std::move( arguments.transform ) );
+        break;
+      }
+    case kind::configure_easing:
+      {
+        auto& arguments( b.easing_configures[ c.arguments ] );
+
+        grow_slots( static_cast< std::size_t >( c.slot ) + 1 );
+        initialize_slot
+          ( c.slot, std::move( arguments.duration ),
+            std::move( arguments.update ), arguments.easing );
+        break;
+      }
+    case kind::configure_parameterized_easing:
+      {
+        auto& arguments( b.parameterized_easing_configures[ c.arguments ] );
+
+        grow_slots( static_cast< std::size_t >( c.slot ) + 1 );
+        initialize_slot
+          ( c.slot, std::move( arguments.duration ),
+            std::move( arguments.update ), arguments.easing );
+        break;
+      }
+    case kind::start:
+      start_slot( c.slot );
+      break;
+    case kind::on_start:
+      on_slot_start( c.slot, std::move( b.callbacks[ c.arguments ] ) );
+      break;
+    case kind::on_done:
+      on_slot_done( c.slot, std::move( b.callbacks[ c.arguments ] ) );
+      break;
+    case kind::sequence:
+      play_in_sequence( static_cast< id_type >( c.arguments ), c.slot );
+      break;
+    case kind::remove:
+      remove_slot( c.slot );
+      break;
+    case kind::tag:
+      tag_slot( c.slot, b.tags[ c.arguments ] );
+      break;
+    case kind::bind_target_and_start:
+      {
+        const auto& arguments( b.targets[ c.arguments ] );
+        const id_type existing
+          ( bind_target( c.slot, arguments.target, arguments.policy ) );
+        const id_type previous
+          ( ( arguments.previous == not_an_id )
+            ? existing : arguments.previous );
+
+        if ( previous == not_an_id )
+          start_slot( c.slot );
+        else
+          play_in_sequence( previous, c.slot );
+
+        break;
+      }
+    case kind::bind_variable:
       {
-        update_from = m_need_update.size();
-        start_slots( m_sequence_queue );
+        const auto& arguments( b.variables[ c.arguments ] );
+        bind_variable
+          ( c.slot, arguments.from, arguments.to, *arguments.variable );
+        break;
       }
-  }
+    case kind::bind_output:
+      {
+        const auto& arguments( b.outputs[ c.arguments ] );
+        bind_output
+          ( c.slot, arguments.from, arguments.to, arguments.buffer,
+            arguments.index );
+        break;
+      }
+    case kind::bind_group:
+      {
+        const auto& arguments( b.groups[ c.arguments ] );
+        bind_group
+          ( c.slot, arguments.from, arguments.to, arguments.group,
+            arguments.key );
+        break;
+      }
+    case kind::set_names:
+      set_slot_names( c.slot, std::move( b.names[ c.arguments ] ) );
+      break;
+    }
 }
 
 /**
@@ -335,6 +1553,9 @@ void tweeners::system_base< Config >::update( duration_type step )
  *
  * No matter if the returned slot is recycled or freshly created, its components
  * are the same.
+ *
+ * The number of slots is bounded by the largest value of id_type, such that
+ * the size of every container in the system fits in an id_type too.
  */
 template< typename Config >
 typename tweeners::system_base< Config >::id_type
@@ -346,13 +1567,10 @@ tweeners::system_base< Config >::create_slot()
   
   if ( m_available_ids.empty() )
     {
-      result = m_slot.size();
-      m_slot.emplace_back();
-      m_slot_states.emplace_back( slot_state::available );
-      m_current_dates.emplace_back();
-      m_start_functions.add_one_slot_at_end();
-      m_done_functions.add_one_slot_at_end();
-      m_successors.add_one_slot_at_end();
+      // The identifier may be beyond the end of the storage if other ids have
+      // been reserved by a command_buffer_base.
+      result = static_cast< id_type >( m_commands.reserve_id() );
+      grow_slots( static_cast< std::size_t >( result ) + 1 );
     }
   else
     {
@@ -360,17 +1578,114 @@ tweeners::system_base< Config >::create_slot()
       m_available_ids.pop_back();
     }
   
-  tweeners_debug_assert( result < m_slot.size() );
-  tweeners_debug_assert( result < m_slot_states.size() );
+  tweeners_debug_assert( static_cast< std::size_t >( result ) < m_slot.size() );
+  tweeners_debug_assert
+    ( static_cast< std::size_t >( result ) < m_slot_states.size() );
   tweeners_debug_assert( m_slot_states[ result ] == slot_state::available );
-  tweeners_debug_assert( result < m_current_dates.size() );
+  tweeners_debug_assert
+    ( static_cast< std::size_t >( result ) < m_current_dates.size() );
   tweeners_debug_assert( !m_start_functions.has_value( result ) );
   tweeners_debug_assert( !m_done_functions.has_value( result ) );
   tweeners_debug_assert( !m_successors.has_value( result ) );
+  tweeners_debug_assert( !m_tags.has_value( result ) );
+  tweeners_debug_assert( !m_targets.has_value( result ) );
 
   return result;
 }
 
+/**
+ * \brief Create the storage of the slots up to a given count.
+ *
+ * \param slot_count The number of slots that must exist in the system.
+ *
+ * The created slots are in the available state but they are not inserted in
+ * m_available_ids: their identifiers have been reserved with
+ * m_commands.reserve_id().
+ */
+template< typename Config >
+void tweeners::system_base< Config >::grow_slots( std::size_t slot_count )
+{
+  while ( m_slot.size() < slot_count )
+    {
+      m_slot.emplace_back();
+      m_slot_states.emplace_back( slot_state::available );
+      m_current_dates.emplace_back();
+      m_end_dates.emplace_back();
+      m_paused.emplace_back( 0 );
+      m_start_functions.add_one_slot_at_end();
+      m_done_functions.add_one_slot_at_end();
+      m_successors.add_one_slot_at_end();
+      m_tags.add_one_slot_at_end();
+      m_tag_indices.add_one_slot_at_end();
+      m_names.add_one_slot_at_end();
+      m_targets.add_one_slot_at_end();
+      m_waiters.add_one_slot_at_end();
+      m_parameterized_easings.add_one_slot_at_end();
+      m_easings.add_one_slot_at_end();
+      m_variables.add_one_slot_at_end();
+      m_outputs.add_one_slot_at_end();
+      m_user_components.add_one_slot_at_end();
+    }
+}
+
+/**
+ * \brief Assign the properties of a slot whose identifier was just allocated.
+ *
+ * The parameters are those of configure_slot().
+ */
+template< typename Config >
+void tweeners::system_base< Config >::initialize_slot
+( id_type slot_id, duration_type duration, update_function update,
+  transform_function transform )
+{
+  tweeners_debug_validate_id( slot_id );
+  tweeners_debug_assert( m_slot_states[ slot_id ] == slot_state::available );
+
+  tweener_state& tweener( m_slot[ slot_id ] );
+
+  m_end_dates[ slot_id ] = duration;
+  tweener.previous = not_an_id;
+  tweener.on_update = std::move( update );
+  tweener.transform = std::move( transform );
+
+  m_slot_states[ slot_id ] = slot_state::ready;
+  m_paused[ slot_id ] = 0;
+  ++m_created_count;
+}
+
+/**
+ * \brief Initialize a slot whose transform is a built-in easing.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::initialize_slot
+( id_type slot_id, duration_type duration, update_function update,
+  easing_id easing )
+{
+  initialize_slot
+    ( slot_id, std::move( duration ), std::move( update ),
+      transform_function() );
+
+  m_easings.emplace
+    ( slot_id,
+      easing_binding
+      { easing_precision::template function< float_type >( easing ),
+        easing } );
+}
+
+/**
+ * \brief Initialize a slot whose transform is a parameterized easing.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::initialize_slot
+( id_type slot_id, duration_type duration, update_function update,
+  const parameterized_easing< float_type >& easing )
+{
+  initialize_slot
+    ( slot_id, std::move( duration ), std::move( update ),
+      transform_function() );
+  m_parameterized_easings.emplace( slot_id, easing );
+}
+
 /**
  * \brief Tells if the given slot id is an acceptable value for input in the
  *        public interface.
@@ -390,15 +1705,6 @@ bool tweeners::system_base< Config >::is_valid_slot_id( id_type slot_id ) const
     && ( m_slot_states[ slot_id ] != slot_state::available );
 }
 
-template< typename Config >
-void tweeners::system_base< Config >::update_current_date( duration_type step )
-{
-  tweeners_debug_system_invariant();
-
-  for ( id_type slot_id : m_need_update )
-    m_current_dates[ slot_id ] += step;
-}
-
 template< typename Config >
 void
 tweeners::system_base< Config >::start_slots( std::vector< id_type >& queue )
@@ -447,14 +1753,20 @@ tweeners::system_base< Config >::start_slots( std::vector< id_type >& queue )
 }
 
 template< typename Config >
-void tweeners::system_base< Config >::update_running_slots( std::size_t from )
+void tweeners::system_base< Config >::update_running_slots
+( id_type from, duration_type step )
 {
   tweeners_debug_system_invariant();
 
+  const std::size_t begin( static_cast< std::size_t >( from ) );
   const std::size_t end( m_need_update.size() );
-  tweeners_debug_assert( from <= end );
-  
-  for ( std::size_t i( from ); i != end; ++i )
+  tweeners_debug_assert( begin <= end );
+
+  // The progression of all the slots is computed first, in a loop without
+  // calls, then the slots are completed and their functions are called.
+  compute_update_ratios( from, step );
+
+  for ( std::size_t i( begin ); i != end; ++i )
     {
       const id_type slot_id( m_need_update[ i ] );
       const slot_state state( m_slot_states[ slot_id ] );
@@ -465,13 +1777,91 @@ void tweeners::system_base< Config >::update_running_slots( std::size_t from )
       tweeners_debug_assert
         ( ( state == slot_state::running ) || ( state == slot_state::dead ) );
       
-      if ( state == slot_state::running )
-        update_tweener( slot_id );
+      if ( ( state == slot_state::running ) && ( m_paused[ slot_id ] == 0 ) )
+        update_tweener
+          ( slot_id, m_update_ratios[ i - begin ],
+            m_update_completed[ i - begin ] != 0 );
+      else
+        m_update_completed[ i - begin ] = 0;
+    }
+
+  call_update_groups();
+}
+
+/**
+ * \brief Advance the date of the slots of m_need_update, from a given index,
+ *        then compute the ratio of their duration and tell which slots reach
+ *        their end.
+ *
+ * \param from The index in m_need_update of the first slot to update.
+ * \param step The time elapsed since the previous update, added to the date
+ *        of the slots that are not paused.
+ *
+ * The results are stored in m_update_ratios and m_update_completed. The
+ * ratios of the paused and dead slots are computed too, and ignored.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::compute_update_ratios
+( id_type from, duration_type step )
+{
+  const std::size_t count( m_need_update.size() - from );
+
+  m_update_dates.resize( count );
+  m_update_end_dates.resize( count );
+  m_update_ratios.resize( count );
+  m_update_completed.resize( count );
+
+  const id_type* const slots( m_need_update.data() + from );
+  duration_type* const current_dates( m_current_dates.data() );
+  const duration_type* const end_dates( m_end_dates.data() );
+  const std::uint8_t* const paused( m_paused.data() );
+  duration_type* const dates( m_update_dates.data() );
+  duration_type* const update_end_dates( m_update_end_dates.data() );
+  float_type* const ratios( m_update_ratios.data() );
+  std::uint8_t* const completed( m_update_completed.data() );
+
+  // The slots are scattered in the storage, thus their dates are first copied
+  // in update order. This gather is the only indirect access.
+  for ( std::size_t i( 0 ); i != count; ++i )
+    {
+      const id_type slot_id( slots[ i ] );
+
+      dates[ i ] =
+        current_dates[ slot_id ]
+        + ( ( paused[ slot_id ] == 0 ) ? step : duration_type() );
+      update_end_dates[ i ] = end_dates[ slot_id ];
+    }
+
+  // The division is done for the completed slots too, then its result is
+  // replaced for these slots, whose duration may be zero.
+  for ( std::size_t i( 0 ); i != count; ++i )
+    {
+      const duration_type current_date( dates[ i ] );
+      const duration_type end_date( update_end_dates[ i ] );
+      const bool done( current_date >= end_date );
+      const float_type ratio
+        ( detail::to_float< float_type >( current_date )
+          / detail::to_float< float_type >( end_date ) );
+
+      completed[ i ] = done;
+      ratios[ i ] = done ? float_type( 1 ) : ratio;
     }
+
+  for ( std::size_t i( 0 ); i != count; ++i )
+    current_dates[ slots[ i ] ] = dates[ i ];
 }
 
+/**
+ * \brief Complete a slot if needed, then pass its value to its destination.
+ *
+ * \param slot_id The slot to update.
+ * \param ratio The ratio of the duration reached by the slot, before the
+ *        transform.
+ * \param completed Tells if the slot reaches its end in this update.
+ */
 template< typename Config >
-void tweeners::system_base< Config >::update_tweener( id_type slot_id )
+void tweeners::system_base< Config >::update_tweener
+( id_type slot_id, float_type ratio, bool completed )
 {
   tweeners_debug_system_invariant();
 
@@ -479,22 +1869,195 @@ void tweeners::system_base< Config >::update_tweener( id_type slot_id )
   tweeners_debug_assert( m_slot_states[ slot_id ] == slot_state::running );
   
   tweener_state& tweener( m_slot[ slot_id ] );
-  const duration_type end_date( tweener.end_date );
-  const duration_type current_date( m_current_dates[ slot_id ] );
-  float_type date_ratio;
 
-  if ( current_date >= end_date )
+  if ( completed )
+    complete_slot
+      ( slot_id, m_current_dates[ slot_id ] - m_end_dates[ slot_id ] );
+
+  const float_type date_ratio( transform_ratio( slot_id, tweener, ratio ) );
+
+  if ( m_variables.has_value( slot_id ) )
     {
-      complete_slot( slot_id, current_date - end_date );
-      date_ratio = tweener.transform( 1 );
+      const variable_binding& binding( m_variables[ slot_id ] );
+      *binding.variable =
+        binding.from + date_ratio * ( binding.to - binding.from );
     }
+  else if ( m_outputs.has_value( slot_id ) )
+    write_output( slot_id, date_ratio );
   else
-    date_ratio =
-      tweener.transform
-      ( detail::to_float< float_type >( current_date )
-        / detail::to_float< float_type >( end_date ) );
-  
-  tweener.on_update( date_ratio );
+    tweener.on_update( date_ratio );
+}
+
+/**
+ * \brief Apply the transform of a slot to the progression of its time.
+ */
+template< typename Config >
+typename tweeners::system_base< Config >::float_type
+tweeners::system_base< Config >::transform_ratio
+( id_type slot_id, const tweener_state& tweener, float_type ratio ) const
+{
+  if ( m_easings.has_value( slot_id ) )
+    return m_easings[ slot_id ].function( ratio );
+
+  if ( m_parameterized_easings.has_value( slot_id ) )
+    return m_parameterized_easings[ slot_id ]( ratio );
+
+  return tweener.transform( ratio );
+}
+
+/**
+ * \brief Store the output binding of a slot.
+ *
+ * \param slot_id The slot writing its values.
+ * \param binding Where the values are written.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::emplace_output
+( id_type slot_id, const output_binding& binding )
+{
+  m_outputs.emplace( slot_id, binding );
+
+  if ( binding.grouped || ( binding.buffer != 0 )
+       || ( binding.index < m_output_values.size() ) )
+    return;
+
+  m_output_values.resize( binding.index + 1 );
+  m_output_buffers[ 0 ].written.resize( ( binding.index + 64 ) / 64 );
+}
+
+/**
+ * \brief Assign the value of a slot bound to an output buffer.
+ *
+ * \param slot_id The slot to write.
+ * \param ratio The transformed progression of the slot.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::write_output
+( id_type slot_id, float_type ratio )
+{
+  const output_binding& binding( m_outputs.get_existing( slot_id ) );
+  const float_type value
+    ( binding.from + ratio * ( binding.to - binding.from ) );
+
+  if ( binding.grouped )
+    {
+      m_update_groups[ binding.buffer ].entries.push_back
+        ( group_entry{ binding.index, value } );
+      return;
+    }
+
+  output_storage& storage( m_output_buffers[ binding.buffer ] );
+
+  // The storage of the system's buffer may have been reallocated since the
+  // beginning of the update, by a binding in a callback.
+  float_type* const values
+    ( ( binding.buffer == 0 ) ? m_output_values.data() : storage.values );
+
+  values[ binding.index * storage.stride ] = value;
+
+  const std::size_t word( binding.index / 64 );
+  storage.written[ word ] |= std::uint64_t( 1 ) << ( binding.index % 64 );
+
+  if ( storage.written_begin == storage.written_end )
+    {
+      storage.written_begin = word;
+      storage.written_end = word + 1;
+    }
+  else
+    {
+      storage.written_begin = std::min( storage.written_begin, word );
+      storage.written_end = std::max( storage.written_end, word + 1 );
+    }
+}
+
+/**
+ * \brief Forget the entries written in the output buffers during the previous
+ *        update.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::reset_output_buffers()
+{
+  for ( output_storage& storage : m_output_buffers )
+    storage.dirty.clear();
+}
+
+/**
+ * \brief Merge the entries written in each output buffer during the current
+ *        update into ranges of consecutive entries.
+ *
+ * The bits of the written entries are scanned in order and cleared for the
+ * next update, only over the words touched during this update.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::collect_dirty_ranges()
+{
+  for ( output_storage& storage : m_output_buffers )
+    {
+      for ( std::size_t word( storage.written_begin );
+            word != storage.written_end; ++word )
+        {
+          std::uint64_t bits( storage.written[ word ] );
+          storage.written[ word ] = 0;
+
+          for ( std::size_t index( word * 64 ); bits != 0;
+                ++index, bits >>= 1 )
+            if ( ( bits & 1 ) != 0 )
+              {
+                if ( storage.dirty.empty()
+                     || ( storage.dirty.back().end != index ) )
+                  storage.dirty.push_back( output_range{ index, index + 1 } );
+                else
+                  storage.dirty.back().end = index + 1;
+              }
+        }
+
+      storage.written_begin = 0;
+      storage.written_end = 0;
+    }
+}
+
+/**
+ * \brief Pass the values collected during the current pass of
+ *        update_running_slots() to the callbacks of their groups.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::call_update_groups()
+{
+  // The callbacks may register new groups, thus the index.
+  for ( std::size_t i( 0 ); i != m_update_groups.size(); ++i )
+    {
+      if ( m_update_groups[ i ].entries.empty() )
+        continue;
+
+      std::vector< group_entry > entries;
+      entries.swap( m_update_groups[ i ].entries );
+
+      m_update_groups[ i ].callback
+        ( span< const group_entry >( entries.data(), entries.size() ) );
+
+      // Give the storage back for the next pass.
+      entries.clear();
+
+      if ( m_update_groups[ i ].entries.empty() )
+        m_update_groups[ i ].entries.swap( entries );
+    }
+}
+
+/**
+ * \brief Copy the values of the buffer owned by the system in the snapshots
+ *        passed to publish_outputs(), if any.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::publish_output_snapshot()
+{
+  if ( m_output_snapshots == nullptr )
+    return;
+
+  // All bound values are copied since the write buffer holds the values of
+  // two or more updates ago. The storage of the buffer is reused.
+  m_output_snapshots->write_buffer().assign
+    ( m_output_values.begin(), m_output_values.end() );
+  m_output_snapshots->publish();
 }
 
 /**
@@ -531,8 +2094,14 @@ void tweeners::system_base< Config >::complete_slot
       m_current_dates[ next ] = successors_current_date;
 }
 
+/**
+ * \brief Call the done callbacks of the slots completed by
+ *        update_running_slots() and remove them from m_need_update.
+ *
+ * \param from The index passed to update_running_slots().
+ */
 template< typename Config >
-void tweeners::system_base< Config >::stop_completed_slots()
+void tweeners::system_base< Config >::stop_completed_slots( id_type from )
 {
   tweeners_debug_system_invariant();
 
@@ -543,7 +2112,23 @@ void tweeners::system_base< Config >::stop_completed_slots()
   auto end( slots.end() );
 
   std::sort( begin, end );
-  remove_ids( m_need_update, begin, end );
+
+  // The completed slots are flagged in m_update_completed, thus they are
+  // removed in a single pass, without searching them.
+  const std::size_t count( m_update_completed.size() );
+  tweeners_debug_assert( m_need_update.size() == from + count );
+
+  id_type* const need_update( m_need_update.data() + from );
+  std::size_t kept( 0 );
+
+  for ( std::size_t i( 0 ); i != count; ++i )
+    if ( m_update_completed[ i ] == 0 )
+      {
+        need_update[ kept ] = need_update[ i ];
+        ++kept;
+      }
+
+  m_need_update.resize( from + kept );
 
   for ( auto it( begin ); it != end; )
     {
@@ -557,12 +2142,23 @@ void tweeners::system_base< Config >::stop_completed_slots()
       else
         {
           state = slot_state::ready;
+
+          if ( m_targets.has_value( *it ) )
+            unbind_target( *it );
+
           ++it;
         }
     }
 
+  // The waiters are detached before any callback is called, such that a
+  // coroutine awaiting one of these slots again waits for its next
+  // completion.
+  m_waiters.take( begin, end );
+
   for ( auto it( begin ); it != end; ++it )
     m_done_functions[ *it ]();
+
+  m_waiters.resume_taken( true );
 }
 
 template< typename Config >
@@ -573,6 +2169,27 @@ void tweeners::system_base< Config >::remove_dead_slots()
   const auto begin( m_dead_queue.begin() );
   const auto end( m_dead_queue.end() );
 
+  if ( begin == end )
+    return;
+
+  release_dead_slots();
+  change_structure();
+  m_waiters.resume_taken( false );
+}
+
+/**
+ * \brief Remove the slots of m_dead_queue from the system, without resuming
+ *        the coroutines waiting for them.
+ *
+ * The identifiers of the slots are appended to m_available_ids and the
+ * waiters are taken from m_waiters, to be resumed by the caller.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::release_dead_slots()
+{
+  const auto begin( m_dead_queue.begin() );
+  const auto end( m_dead_queue.end() );
+
   std::sort( begin, end );
   
   for ( auto it( begin ); it != end; ++it )
@@ -585,6 +2202,12 @@ void tweeners::system_base< Config >::remove_dead_slots()
 
       if ( tweener.previous != not_an_id )
         remove_from_predecessor_successors( tweener.previous, slot_id );
+
+      if ( m_tags.has_value( slot_id ) )
+        remove_from_tagged_slots( slot_id );
+
+      if ( m_targets.has_value( slot_id ) )
+        unbind_target( slot_id );
     }
 
   for ( auto it( begin ); it != end; ++it )
@@ -597,6 +2220,18 @@ void tweeners::system_base< Config >::remove_dead_slots()
   m_start_functions.erase( begin, end );
   m_done_functions.erase( begin, end );
   m_successors.erase( begin, end );
+  m_tags.erase( begin, end );
+  m_tag_indices.erase( begin, end );
+  m_names.erase( begin, end );
+  m_targets.erase( begin, end );
+  m_parameterized_easings.erase( begin, end );
+  m_easings.erase( begin, end );
+  m_variables.erase( begin, end );
+  m_outputs.erase( begin, end );
+  m_user_components.erase
+    ( m_dead_queue.data(), m_dead_queue.data() + m_dead_queue.size() );
+
+  m_waiters.take( begin, end );
 
   remove_ids( m_start_queue, begin, end );
   remove_ids( m_done_queue, begin, end );
@@ -630,6 +2265,67 @@ void tweeners::system_base< Config >::remove_from_predecessor_successors
   successors.pop_back();
 }
 
+/**
+ * \brief Assign a tag to a slot, which is not in the slots of another tag.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::add_to_tagged_slots
+( id_type slot_id, tag_type tag )
+{
+  tweeners_debug_validate_id( slot_id );
+
+  std::vector< id_type >& slots( m_tagged_slots[ tag ] );
+
+  m_tags.emplace( slot_id, tag );
+  m_tag_indices.emplace
+    ( slot_id, static_cast< tag_index_type >( slots.size() ) );
+  slots.emplace_back( slot_id );
+}
+
+/**
+ * \brief Remove a slot from the slots of its tag, by moving the last slot of
+ *        the tag in its place.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::remove_from_tagged_slots
+( id_type slot_id )
+{
+  tweeners_debug_validate_id( slot_id );
+  tweeners_debug_assert( m_tags.has_value( slot_id ) );
+
+  const auto tag_it( m_tagged_slots.find( m_tags[ slot_id ] ) );
+  tweeners_debug_assert( tag_it != m_tagged_slots.end() );
+
+  std::vector< id_type >& slots( tag_it->second );
+  const tag_index_type index( m_tag_indices[ slot_id ] );
+  tweeners_debug_assert( index < slots.size() );
+  tweeners_debug_assert( slots[ index ] == slot_id );
+
+  const id_type last( slots.back() );
+  slots[ index ] = last;
+  m_tag_indices.get_existing( last ) = index;
+  slots.pop_back();
+
+  if ( slots.empty() )
+    m_tagged_slots.erase( tag_it );
+}
+
+/**
+ * \brief Remove the association from the target of a slot to this slot, if
+ *        any.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::unbind_target( id_type slot_id )
+{
+  tweeners_debug_validate_id( slot_id );
+  tweeners_debug_assert( m_targets.has_value( slot_id ) );
+
+  const auto it( m_slot_from_target.find( m_targets[ slot_id ] ) );
+
+  if ( ( it != m_slot_from_target.end() ) && ( it->second == slot_id ) )
+    m_slot_from_target.erase( it );
+}
+
 template< typename Config >
 void tweeners::system_base< Config >::remove_ids
 ( std::vector< id_type >& ids, id_iterator first,
@@ -681,6 +2377,8 @@ void tweeners::system_base< Config >::check_invariants() const
   check_update_queue_invariants();
   check_sequences_invariants();
   check_available_ids();
+  check_tags_invariants();
+  check_targets_invariants();
 }
 
 /**
@@ -717,9 +2415,10 @@ void tweeners::system_base< Config >::check_update_queue_invariants() const
 template< typename Config >
 void tweeners::system_base< Config >::check_sequences_invariants() const
 {
-  const std::size_t allocated_slot_count( m_slot_states.size() );
+  const id_type allocated_slot_count
+    ( static_cast< id_type >( m_slot_states.size() ) );
 
-  for ( std::size_t slot_id( 0 ); slot_id != allocated_slot_count; ++slot_id )
+  for ( id_type slot_id( 0 ); slot_id != allocated_slot_count; ++slot_id )
     if ( ( m_slot_states[ slot_id ] != slot_state::available )
          && ( m_slot_states[ slot_id ] != slot_state::dead ) )
       {
@@ -755,19 +2454,23 @@ void tweeners::system_base< Config >::check_available_ids() const
       tweeners_debug_not_in_container( slot_id, m_dead_queue );
       tweeners_debug_not_in_container( slot_id, m_sequence_queue );
 
-      tweeners_debug_assert( slot_id < m_slot.size() );
-      tweeners_debug_assert( slot_id < m_slot_states.size() );
+      tweeners_debug_assert
+        ( static_cast< std::size_t >( slot_id ) < m_slot.size() );
+      tweeners_debug_assert
+        ( static_cast< std::size_t >( slot_id ) < m_slot_states.size() );
       tweeners_debug_assert
         ( m_slot_states[ slot_id ] == slot_state::available );
-      tweeners_debug_assert( slot_id < m_current_dates.size() );
+      tweeners_debug_assert
+        ( static_cast< std::size_t >( slot_id ) < m_current_dates.size() );
       tweeners_debug_assert( !m_start_functions.has_value( slot_id ) );
       tweeners_debug_assert( !m_done_functions.has_value( slot_id ) );
       tweeners_debug_assert( !m_successors.has_value( slot_id ) );
     }
 
-  const std::size_t allocated_slot_count( m_slot_states.size() );
+  const id_type allocated_slot_count
+    ( static_cast< id_type >( m_slot_states.size() ) );
 
-  for ( std::size_t slot_id( 0 ); slot_id != allocated_slot_count; ++slot_id )
+  for ( id_type slot_id( 0 ); slot_id != allocated_slot_count; ++slot_id )
     if ( ( m_slot_states[ slot_id ] != slot_state::available )
          && ( m_slot_states[ slot_id ] != slot_state::dead )
          && ( m_slot[ slot_id ].previous != not_an_id ) )
@@ -775,6 +2478,64 @@ void tweeners::system_base< Config >::check_available_ids() const
         ( m_slot[ slot_id ].previous, m_available_ids );
 }
 
+/**
+ * \brief Validate the consistency of m_tags and m_tagged_slots.
+ *
+ * - If a slot is in m_tagged_slots[ t ] then its tag is t.
+ * - If a slot has a tag t then it is in m_tagged_slots[ t ].
+ * - There is no tag without slots in m_tagged_slots.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::check_tags_invariants() const
+{
+  for ( const auto& entry : m_tagged_slots )
+    {
+      tweeners_debug_assert( !entry.second.empty() );
+
+      for ( id_type slot_id : entry.second )
+        {
+          tweeners_debug_validate_id( slot_id );
+          tweeners_debug_assert
+            ( m_slot_states[ slot_id ] != slot_state::available );
+          tweeners_debug_assert( m_tags.has_value( slot_id ) );
+          tweeners_debug_assert( m_tags[ slot_id ] == entry.first );
+          tweeners_debug_assert( m_tag_indices.has_value( slot_id ) );
+          tweeners_debug_assert
+            ( entry.second[ m_tag_indices[ slot_id ] ] == slot_id );
+        }
+    }
+
+  const id_type allocated_slot_count
+    ( static_cast< id_type >( m_slot_states.size() ) );
+
+  for ( id_type slot_id( 0 ); slot_id != allocated_slot_count; ++slot_id )
+    if ( m_tags.has_value( slot_id ) )
+      {
+        const auto it( m_tagged_slots.find( m_tags[ slot_id ] ) );
+        tweeners_debug_assert( it != m_tagged_slots.end() );
+        tweeners_debug_not_in_container( slot_id, m_available_ids );
+      }
+}
+
+/**
+ * \brief Validate the consistency of m_targets and m_slot_from_target.
+ *
+ * - If m_slot_from_target associates a slot to a target, then the slot exists
+ *   and is bound to this target.
+ */
+template< typename Config >
+void tweeners::system_base< Config >::check_targets_invariants() const
+{
+  for ( const auto& entry : m_slot_from_target )
+    {
+      tweeners_debug_validate_id( entry.second );
+      tweeners_debug_assert
+        ( m_slot_states[ entry.second ] != slot_state::available );
+      tweeners_debug_assert( m_targets.has_value( entry.second ) );
+      tweeners_debug_assert( m_targets[ entry.second ] == entry.first );
+    }
+}
+
 #undef tweeners_debug_not_in_container
 #undef tweeners_debug_system_invariant
 #undef tweeners_debug_validate_id
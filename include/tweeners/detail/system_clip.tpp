@@ -0,0 +1,100 @@
+#ifndef TWEENERS_DETAIL_SYSTEM_CLIP_TPP
+#define TWEENERS_DETAIL_SYSTEM_CLIP_TPP
+
+#include <tweeners/contract.hpp>
+#include <tweeners/detail/debug.hpp>
+
+#define tweeners_debug_system_invariant()         \
+  tweeners_debug_declare_scope_guard              \
+  ( [ this ]() -> void { check_invariants(); } )
+
+/**
+ * \brief Create and start the slots of a clip.
+ *
+ * \param c The clip to instantiate.
+ * \param bindings The entries receiving the values of the parameters of the
+ *        clip.
+ *
+ * \return The identifiers of the created slots, in the order of the nodes of
+ *         the clip.
+ *
+ * The slots write their values in the output buffer of the bindings, like with
+ * bind_output(). The nodes without predecessor are started, the other ones are
+ * played in sequence after their predecessor. The clip is not used anymore
+ * after the call.
+ *
+ * The bindings are checked before the creation of the slots, then the slots
+ * are created in a single pass over the nodes. Since the slots are new, the
+ * checks done by start_slot() and play_in_sequence() are not needed.
+ *
+ * This function is defined in tweeners/clip.hpp, such that the headers of the
+ * system do not depend on the loading of the clips.
+ */
+template< typename Config >
+std::vector< typename tweeners::system_base< Config >::id_type >
+tweeners::system_base< Config >::instantiate
+( const clip& c, const clip_bindings& bindings )
+{
+  tweeners_debug_system_invariant();
+
+  const std::size_t parameter_count( c.parameter_count() );
+  const std::size_t buffer( bindings.buffer.m_index );
+
+  tweeners_confirm_contract
+    ( bindings.entries.size() >= parameter_count,
+      "system::instantiate(): some parameters are not bound." );
+  tweeners_confirm_contract
+    ( buffer < m_output_buffers.size(),
+      "system::instantiate(): buffer does not exist." );
+
+  const std::size_t entry_count
+    ( ( buffer == 0 )
+      ? m_slot_states.size()
+      : m_output_buffers[ buffer ].count );
+
+  for ( std::size_t i( 0 ); i != parameter_count; ++i )
+    tweeners_confirm_contract
+      ( bindings.entries[ i ] < entry_count,
+        "system::instantiate(): index is out of the buffer." );
+
+  const span< const clip_node > nodes( c.nodes() );
+  std::vector< id_type > result;
+  result.reserve( nodes.size() );
+
+  for ( const clip_node& node : nodes )
+    {
+      const id_type slot_id( create_slot() );
+      initialize_slot
+        ( slot_id, detail::from_float< duration_type >( node.duration ),
+          update_function(), static_cast< easing_id >( node.easing ) );
+      emplace_output
+        ( slot_id,
+          output_binding
+          { node.from, node.to, buffer, bindings.entries[ node.parameter ],
+            false } );
+
+      if ( node.predecessor == clip_node::no_predecessor )
+        {
+          m_current_dates[ slot_id ] = duration_type();
+          m_start_queue.emplace_back( slot_id );
+        }
+      else
+        {
+          const id_type previous( result[ node.predecessor ] );
+
+          if ( !m_successors.has_value( previous ) )
+            m_successors.emplace( previous );
+
+          m_successors.get_existing( previous ).emplace_back( slot_id );
+          m_slot[ slot_id ].previous = previous;
+        }
+
+      result.push_back( slot_id );
+    }
+
+  return result;
+}
+
+#undef tweeners_debug_system_invariant
+
+#endif
@@ -0,0 +1,389 @@
+#ifndef TWEENERS_DETAIL_SYSTEM_POOL_TPP
+#define TWEENERS_DETAIL_SYSTEM_POOL_TPP
+
+#include <tweeners/contract.hpp>
+
+#include <algorithm>
+#include <utility>
+
+/**
+ * \brief Create a pool updating its systems with a given number of threads.
+ *
+ * \param thread_count The number of threads updating the systems, including
+ *        the thread calling update(). Thus thread_count - 1 threads are
+ *        created.
+ */
+template< typename Config >
+tweeners::system_pool_base< Config >::system_pool_base
+( std::size_t thread_count )
+  : m_step(),
+    m_pending( 0 ),
+    m_generation( 0 ),
+    m_stop( false )
+{
+  tweeners_confirm_contract
+    ( thread_count > 0, "system_pool: thread_count must be positive." );
+
+  m_queues.reserve( thread_count );
+
+  for ( std::size_t i( 0 ); i != thread_count; ++i )
+    m_queues.emplace_back( new worker_queue() );
+
+  m_threads.reserve( thread_count - 1 );
+
+  for ( std::size_t i( 1 ); i != thread_count; ++i )
+    m_threads.emplace_back( &system_pool_base::worker_loop, this, i );
+}
+
+/**
+ * \brief Stop the threads. The systems owned by the pool are destroyed.
+ */
+template< typename Config >
+tweeners::system_pool_base< Config >::~system_pool_base()
+{
+  {
+    std::unique_lock< std::mutex > lock( m_mutex );
+    m_stop = true;
+  }
+
+  m_wake_up.notify_all();
+
+  for ( std::thread& t : m_threads )
+    t.join();
+}
+
+/**
+ * \brief Get the number of threads updating the systems, including the thread
+ *        calling update().
+ */
+template< typename Config >
+std::size_t tweeners::system_pool_base< Config >::thread_count() const
+{
+  return m_queues.size();
+}
+
+/**
+ * \brief Create a system owned by the pool.
+ *
+ * \return The index of the system, to be passed to get(), remove() and
+ *         update_cost().
+ */
+template< typename Config >
+std::size_t tweeners::system_pool_base< Config >::emplace()
+{
+  std::unique_ptr< system_type > system( new system_type() );
+  const std::size_t result( insert( system.get() ) );
+
+  m_entries[ result ].owned = std::move( system );
+
+  return result;
+}
+
+/**
+ * \brief Add a system owned by the client code to the pool.
+ *
+ * \return The index of the system, to be passed to get(), remove() and
+ *         update_cost().
+ *
+ * The system must outlive the pool or be removed from it before being
+ * destroyed.
+ */
+template< typename Config >
+std::size_t tweeners::system_pool_base< Config >::add( system_type& system )
+{
+  return insert( &system );
+}
+
+/**
+ * \brief Remove a system from the pool. The system is destroyed if it is owned
+ *        by the pool.
+ *
+ * The index may be returned by a later call to add() or emplace().
+ */
+template< typename Config >
+void tweeners::system_pool_base< Config >::remove( std::size_t index )
+{
+  tweeners_confirm_contract
+    ( ( index < m_entries.size() ) && ( m_entries[ index ].system != nullptr ),
+      "system_pool::remove(): system does not exist." );
+
+  entry& e( m_entries[ index ] );
+  e.system = nullptr;
+  e.owned.reset();
+
+  m_available_entries.push_back( index );
+}
+
+template< typename Config >
+typename tweeners::system_pool_base< Config >::system_type&
+tweeners::system_pool_base< Config >::get( std::size_t index )
+{
+  tweeners_confirm_contract
+    ( ( index < m_entries.size() ) && ( m_entries[ index ].system != nullptr ),
+      "system_pool::get(): system does not exist." );
+
+  return *m_entries[ index ].system;
+}
+
+/**
+ * \brief Get the number of systems in the pool.
+ */
+template< typename Config >
+std::size_t tweeners::system_pool_base< Config >::size() const
+{
+  return m_entries.size() - m_available_entries.size();
+}
+
+/**
+ * \brief Call system_base::update() on all the systems of the pool.
+ *
+ * \param step The elapsed duration since the last update.
+ *
+ * The function returns when all the systems are updated. If the update of a
+ * system throws, the other systems are updated nonetheless and the first
+ * exception is rethrown when they are done.
+ *
+ * The functions of the pool and of its systems must not be called from the
+ * callbacks of the tweeners.
+ */
+template< typename Config >
+void tweeners::system_pool_base< Config >::update( duration_type step )
+{
+  if ( size() == 0 )
+    return;
+
+  m_step = step;
+  m_error = nullptr;
+
+  // The counter must be set before the systems are queued since an idle
+  // worker may steal them as soon as they are in a queue.
+  m_pending = size();
+  dispatch();
+
+  {
+    std::unique_lock< std::mutex > lock( m_mutex );
+    ++m_generation;
+  }
+
+  m_wake_up.notify_all();
+  work( 0 );
+
+  std::exception_ptr error;
+
+  {
+    std::unique_lock< std::mutex > lock( m_mutex );
+    m_done.wait( lock, [ this ]() -> bool { return m_pending == 0; } );
+    std::swap( error, m_error );
+  }
+
+  if ( error )
+    std::rethrow_exception( error );
+}
+
+/**
+ * \brief Get the duration of the last update of a given system.
+ */
+template< typename Config >
+std::chrono::nanoseconds
+tweeners::system_pool_base< Config >::update_cost( std::size_t index ) const
+{
+  tweeners_confirm_contract
+    ( ( index < m_entries.size() ) && ( m_entries[ index ].system != nullptr ),
+      "system_pool::update_cost(): system does not exist." );
+
+  return m_entries[ index ].cost;
+}
+
+template< typename Config >
+std::size_t
+tweeners::system_pool_base< Config >::insert( system_type* system )
+{
+  std::size_t result;
+
+  if ( m_available_entries.empty() )
+    {
+      result = m_entries.size();
+      m_entries.emplace_back();
+    }
+  else
+    {
+      result = m_available_entries.back();
+      m_available_entries.pop_back();
+    }
+
+  entry& e( m_entries[ result ] );
+  e.system = system;
+  e.cost = std::chrono::nanoseconds( 0 );
+
+  return result;
+}
+
+/**
+ * \brief Distribute the systems in the queues of the workers.
+ *
+ * The systems are considered from the one having the most running slots to the
+ * one having the fewest, and each system is given to the worker having the
+ * fewest running slots to update so far. Each worker then processes its queue
+ * from the front, thus the biggest systems are started first and the smallest
+ * ones remain available for stealing at the back of the queues.
+ */
+template< typename Config >
+void tweeners::system_pool_base< Config >::dispatch()
+{
+  std::vector< std::pair< std::size_t, std::size_t > > weights;
+  weights.reserve( size() );
+
+  for ( std::size_t i( 0 ), n( m_entries.size() ); i != n; ++i )
+    if ( m_entries[ i ].system != nullptr )
+      // The system is updated even if nothing runs, thus the minimal weight.
+      weights.emplace_back( m_entries[ i ].system->running_count() + 1, i );
+
+  std::sort
+    ( weights.begin(), weights.end(),
+      []( const std::pair< std::size_t, std::size_t >& a,
+          const std::pair< std::size_t, std::size_t >& b ) -> bool
+      {
+        return a.first > b.first;
+      } );
+
+  const std::size_t worker_count( m_queues.size() );
+  std::vector< std::size_t > loads( worker_count, 0 );
+  std::vector< std::vector< std::size_t > > assignment( worker_count );
+
+  for ( const std::pair< std::size_t, std::size_t >& w : weights )
+    {
+      const std::size_t worker
+        ( std::min_element( loads.begin(), loads.end() ) - loads.begin() );
+
+      loads[ worker ] += w.first;
+      assignment[ worker ].push_back( w.second );
+    }
+
+  for ( std::size_t i( 0 ); i != worker_count; ++i )
+    {
+      worker_queue& q( *m_queues[ i ] );
+      std::unique_lock< std::mutex > lock( q.mutex );
+      q.systems.insert
+        ( q.systems.end(), assignment[ i ].begin(), assignment[ i ].end() );
+    }
+}
+
+/**
+ * \brief Update the systems from the queue of a given worker, then steal the
+ *        systems from the other queues until all queues are empty.
+ */
+template< typename Config >
+void tweeners::system_pool_base< Config >::work( std::size_t worker_index )
+{
+  std::size_t system_index;
+
+  while ( pop( worker_index, system_index ) )
+    {
+      run( system_index );
+
+      if ( m_pending.fetch_sub( 1 ) == 1 )
+        {
+          std::unique_lock< std::mutex > lock( m_mutex );
+          m_done.notify_all();
+        }
+    }
+}
+
+/**
+ * \brief Take the next system to update by a given worker.
+ *
+ * \return false if there is no system left to update.
+ *
+ * The system is taken from the front of the worker's queue, or from the back of
+ * the queue of another worker if the former is empty.
+ */
+template< typename Config >
+bool tweeners::system_pool_base< Config >::pop
+( std::size_t worker_index, std::size_t& system_index )
+{
+  {
+    worker_queue& q( *m_queues[ worker_index ] );
+    std::unique_lock< std::mutex > lock( q.mutex );
+
+    if ( !q.systems.empty() )
+      {
+        system_index = q.systems.front();
+        q.systems.pop_front();
+        return true;
+      }
+  }
+
+  const std::size_t worker_count( m_queues.size() );
+
+  for ( std::size_t i( 1 ); i != worker_count; ++i )
+    {
+      worker_queue& q( *m_queues[ ( worker_index + i ) % worker_count ] );
+      std::unique_lock< std::mutex > lock( q.mutex );
+
+      if ( !q.systems.empty() )
+        {
+          system_index = q.systems.back();
+          q.systems.pop_back();
+          return true;
+        }
+    }
+
+  return false;
+}
+
+/**
+ * \brief Update a system and measure the duration of the update.
+ */
+template< typename Config >
+void tweeners::system_pool_base< Config >::run( std::size_t system_index )
+{
+  using clock = std::chrono::steady_clock;
+
+  entry& e( m_entries[ system_index ] );
+  const clock::time_point start( clock::now() );
+
+  try
+    {
+      e.system->update( m_step );
+    }
+  catch( ... )
+    {
+      std::unique_lock< std::mutex > lock( m_mutex );
+
+      if ( !m_error )
+        m_error = std::current_exception();
+    }
+
+  e.cost =
+    std::chrono::duration_cast< std::chrono::nanoseconds >
+    ( clock::now() - start );
+}
+
+template< typename Config >
+void tweeners::system_pool_base< Config >::worker_loop
+( std::size_t worker_index )
+{
+  std::size_t generation( 0 );
+
+  while ( true )
+    {
+      {
+        std::unique_lock< std::mutex > lock( m_mutex );
+        m_wake_up.wait
+          ( lock,
+            [ this, generation ]() -> bool
+            {
+              return m_stop || ( m_generation != generation );
+            } );
+
+        if ( m_stop )
+          return;
+
+        generation = m_generation;
+      }
+
+      work( worker_index );
+    }
+}
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef TWEENERS_DETAIL_SYSTEM_SERIALIZER_HPP
+#define TWEENERS_DETAIL_SYSTEM_SERIALIZER_HPP
+
+#include <tweeners/callback_registry.hpp>
+#include <tweeners/system.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace tweeners
+{
+  namespace detail
+  {
+    /**
+     * \brief The implementation of tweeners::save_system() and
+     *        tweeners::load_system().
+     *
+     * The data begins with a header made of the "TWNR" magic, the version of
+     * the format, a byte order mark and the sizes of the types of the
+     * configuration. It is followed by the number of slots, the slots in the
+     * order of their identifiers, then the queues of the system.
+     */
+    template< typename Config >
+    class system_serializer
+    {
+    public:
+      using system_type = system_base< Config >;
+      using registry_type = callback_registry_base< Config >;
+
+    public:
+      static void save( const system_type& system, std::ostream& stream );
+      static void load
+      ( system_type& system, std::istream& stream,
+        const registry_type& callbacks );
+
+    private:
+      using duration_type = typename system_type::duration_type;
+      using id_type = typename system_type::id_type;
+      using float_type = typename system_type::float_type;
+      using tag_type = typename system_type::tag_type;
+      using slot_state = typename system_type::slot_state;
+      using output_binding = typename system_type::output_binding;
+      using easing_binding = typename system_type::easing_binding;
+
+      /**
+       * \brief The version of the format written by save(). Version 2 added
+       *        the parameterized easings, thus load() also accepts version 1.
+       */
+      static constexpr std::uint32_t version = 2;
+
+      /**
+       * \brief The value stored instead of an easing identifier when the
+       *        transform is found in the registry.
+       */
+      static constexpr std::uint8_t named_transform = 255;
+
+      /**
+       * \brief The value stored instead of an easing identifier when the
+       *        transform is a parameterized_easing.
+       */
+      static constexpr std::uint8_t parameterized_transform = 254;
+
+    private:
+      static void save_header( std::ostream& stream );
+      static void load_header( std::istream& stream );
+
+      static void save_slot
+      ( const system_type& system, id_type slot_id, std::ostream& stream );
+      static void load_slot
+      ( system_type& system, id_type slot_id, std::istream& stream,
+        const registry_type& callbacks );
+
+      static void save_functions
+      ( const system_type& system, id_type slot_id, std::ostream& stream );
+      static void load_functions
+      ( system_type& system, id_type slot_id, std::istream& stream,
+        const registry_type& callbacks );
+
+      static void save_ids
+      ( const std::vector< id_type >& ids, std::ostream& stream );
+      static std::vector< id_type >
+      all_available_ids( const system_type& system );
+      static void load_ids
+      ( const system_type& system, std::vector< id_type >& ids,
+        std::istream& stream );
+      static id_type load_id( const system_type& system, std::istream& stream );
+
+      static void check_queues( const system_type& system );
+      static void check_queue
+      ( const system_type& system, const std::vector< id_type >& ids,
+        slot_state first_state, slot_state second_state,
+        std::vector< std::uint8_t >& marks, std::uint8_t mark );
+      static void check_sequences( const system_type& system );
+
+      template< typename T >
+      static void write( std::ostream& stream, T value );
+
+      template< typename T >
+      static T read( std::istream& stream );
+
+      static void write_string( std::ostream& stream, const std::string& s );
+      static std::string read_string( std::istream& stream );
+    };
+  }
+}
+
+#include <tweeners/detail/system_serializer.tpp>
+
+#endif
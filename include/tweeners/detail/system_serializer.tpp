@@ -0,0 +1,657 @@
+#ifndef TWEENERS_DETAIL_SYSTEM_SERIALIZER_TPP
+#define TWEENERS_DETAIL_SYSTEM_SERIALIZER_TPP
+
+#include <tweeners/contract.hpp>
+#include <tweeners/easing_id.hpp>
+
+#include <algorithm>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::save
+( const system_type& system, std::ostream& stream )
+{
+  tweeners_confirm_contract
+    ( system.m_done_queue.empty() && system.m_sequence_queue.empty(),
+      "save_system(): cannot save during an update." );
+
+  save_header( stream );
+
+  const std::size_t slot_count( system.m_slot_states.size() );
+  write< std::uint64_t >( stream, slot_count );
+
+  for ( std::size_t i( 0 ); i != slot_count; ++i )
+    save_slot( system, static_cast< id_type >( i ), stream );
+
+  save_ids( system.m_start_queue, stream );
+  save_ids( system.m_dead_queue, stream );
+  save_ids( all_available_ids( system ), stream );
+  save_ids( system.m_need_update, stream );
+
+  tweeners_confirm_contract
+    ( stream, "save_system(): failed to write the data." );
+}
+
+/**
+ * \brief Read the slots of a system saved with save().
+ *
+ * If the data is invalid, an exception is thrown and the system is left in an
+ * inconsistent state. It must then be discarded.
+ */
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::load
+( system_type& system, std::istream& stream, const registry_type& callbacks )
+{
+  tweeners_confirm_contract
+    ( system.m_commands.reserved_id_count() == 0,
+      "load_system(): the system already has slots." );
+
+  load_header( stream );
+
+  const std::uint64_t slot_count( read< std::uint64_t >( stream ) );
+
+  tweeners_confirm_contract
+    ( slot_count
+      < static_cast< std::uint64_t >( std::numeric_limits< id_type >::max() ),
+      "load_system(): too many slots for id_type." );
+
+  system.m_commands.reserve_ids_below( slot_count );
+  system.grow_slots( slot_count );
+
+  for ( std::size_t i( 0 ); i != slot_count; ++i )
+    load_slot( system, static_cast< id_type >( i ), stream, callbacks );
+
+  load_ids( system, system.m_start_queue, stream );
+  load_ids( system, system.m_dead_queue, stream );
+  load_ids( system, system.m_available_ids, stream );
+  load_ids( system, system.m_need_update, stream );
+
+  check_queues( system );
+  check_sequences( system );
+
+  system.change_structure();
+}
+
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::save_header
+( std::ostream& stream )
+{
+  stream.write( "TWNR", 4 );
+
+  write< std::uint32_t >( stream, version );
+  write< std::uint32_t >( stream, 0x01020304 );
+  write< std::uint8_t >( stream, sizeof( id_type ) );
+  write< std::uint8_t >( stream, sizeof( duration_type ) );
+  write< std::uint8_t >( stream, sizeof( float_type ) );
+  write< std::uint8_t >( stream, sizeof( tag_type ) );
+}
+
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::load_header
+( std::istream& stream )
+{
+  char magic[ 4 ];
+  stream.read( magic, 4 );
+
+  tweeners_confirm_contract
+    ( stream && ( std::string( magic, 4 ) == "TWNR" ),
+      "load_system(): the data is not a saved system." );
+  const std::uint32_t saved_version( read< std::uint32_t >( stream ) );
+
+  tweeners_confirm_contract
+    ( ( saved_version >= 1 ) && ( saved_version <= version ),
+      "load_system(): unsupported version." );
+  tweeners_confirm_contract
+    ( read< std::uint32_t >( stream ) == 0x01020304,
+      "load_system(): the data was saved with another byte order." );
+
+  const std::uint8_t id_size( read< std::uint8_t >( stream ) );
+  const std::uint8_t duration_size( read< std::uint8_t >( stream ) );
+  const std::uint8_t float_size( read< std::uint8_t >( stream ) );
+  const std::uint8_t tag_size( read< std::uint8_t >( stream ) );
+
+  tweeners_confirm_contract
+    ( ( id_size == sizeof( id_type ) )
+      && ( duration_size == sizeof( duration_type ) )
+      && ( float_size == sizeof( float_type ) )
+      && ( tag_size == sizeof( tag_type ) ),
+      "load_system(): the data was saved with another configuration." );
+}
+
+/**
+ * \brief Write the state of a slot. The available slots are stored as their
+ *        state only, and the functions of the removed slots are not stored.
+ */
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::save_slot
+( const system_type& system, id_type slot_id, std::ostream& stream )
+{
+  const slot_state state( system.m_slot_states[ slot_id ] );
+  write< std::uint8_t >( stream, static_cast< std::uint8_t >( state ) );
+
+  if ( state == slot_state::available )
+    return;
+
+  write( stream, system.m_end_dates[ slot_id ] );
+  write( stream, system.m_current_dates[ slot_id ] );
+  write( stream, system.m_slot[ slot_id ].previous );
+  write< std::uint8_t >( stream, system.m_paused[ slot_id ] );
+  save_ids( system.m_successors[ slot_id ], stream );
+
+  if ( state == slot_state::dead )
+    return;
+
+  save_functions( system, slot_id, stream );
+
+  if ( system.m_tags.has_value( slot_id ) )
+    {
+      write< std::uint8_t >( stream, 1 );
+      write( stream, system.m_tags[ slot_id ] );
+    }
+  else
+    write< std::uint8_t >( stream, 0 );
+
+  if ( system.m_outputs.has_value( slot_id ) )
+    {
+      const output_binding& binding( system.m_outputs[ slot_id ] );
+
+      write< std::uint8_t >( stream, 1 );
+      write( stream, binding.from );
+      write( stream, binding.to );
+      write< std::uint64_t >( stream, binding.buffer );
+      write< std::uint64_t >( stream, binding.index );
+      write< std::uint8_t >( stream, binding.grouped );
+    }
+  else
+    write< std::uint8_t >( stream, 0 );
+}
+
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::load_slot
+( system_type& system, id_type slot_id, std::istream& stream,
+  const registry_type& callbacks )
+{
+  const std::uint8_t state( read< std::uint8_t >( stream ) );
+
+  tweeners_confirm_contract
+    ( ( state == static_cast< std::uint8_t >( slot_state::ready ) )
+      || ( state == static_cast< std::uint8_t >( slot_state::running ) )
+      || ( state == static_cast< std::uint8_t >( slot_state::dead ) )
+      || ( state == static_cast< std::uint8_t >( slot_state::available ) ),
+      "load_system(): invalid slot state." );
+
+  system.m_slot_states[ slot_id ] = static_cast< slot_state >( state );
+
+  if ( system.m_slot_states[ slot_id ] == slot_state::available )
+    return;
+
+  system.m_end_dates[ slot_id ] = read< duration_type >( stream );
+  system.m_current_dates[ slot_id ] = read< duration_type >( stream );
+
+  const id_type previous( read< id_type >( stream ) );
+
+  tweeners_confirm_contract
+    ( ( previous == system_type::not_an_id )
+      || ( ( previous >= 0 )
+           && ( static_cast< std::size_t >( previous )
+                < system.m_slot_states.size() ) ),
+      "load_system(): invalid slot identifier." );
+
+  system.m_slot[ slot_id ].previous = previous;
+  system.m_paused[ slot_id ] = ( read< std::uint8_t >( stream ) != 0 );
+
+  std::vector< id_type > successors;
+  load_ids( system, successors, stream );
+
+  if ( !successors.empty() )
+    system.m_successors.emplace( slot_id, std::move( successors ) );
+
+  if ( system.m_slot_states[ slot_id ] == slot_state::dead )
+    return;
+
+  load_functions( system, slot_id, stream, callbacks );
+
+  if ( read< std::uint8_t >( stream ) != 0 )
+    {
+      system.add_to_tagged_slots( slot_id, read< tag_type >( stream ) );
+    }
+
+  if ( read< std::uint8_t >( stream ) != 0 )
+    {
+      output_binding binding;
+      binding.from = read< float_type >( stream );
+      binding.to = read< float_type >( stream );
+      binding.buffer = read< std::uint64_t >( stream );
+      binding.index = read< std::uint64_t >( stream );
+      binding.grouped = ( read< std::uint8_t >( stream ) != 0 );
+
+      if ( binding.grouped )
+        tweeners_confirm_contract
+          ( binding.buffer < system.m_update_groups.size(),
+            "load_system(): group does not exist." );
+      else
+        {
+          tweeners_confirm_contract
+            ( binding.buffer < system.m_output_buffers.size(),
+              "load_system(): buffer does not exist." );
+          tweeners_confirm_contract
+            ( binding.index
+              < ( ( binding.buffer == 0 )
+                  ? system.m_slot_states.size()
+                  : system.m_output_buffers[ binding.buffer ].count ),
+              "load_system(): index is out of the buffer." );
+        }
+
+      system.emplace_output( slot_id, binding );
+    }
+
+  tweeners_confirm_contract
+    ( system.m_slot[ slot_id ].on_update
+      || system.m_outputs.has_value( slot_id ),
+      "load_system(): a slot has neither update function nor output." );
+}
+
+/**
+ * \brief Write the names of the functions of a slot.
+ *
+ * The transform is written as parameterized_transform followed by its
+ * identifier and its parameters if it is a parameterized_easing, as an
+ * easing_id if it is a built-in easing or if its name is the one of a built-in
+ * easing, otherwise as named_transform followed by its name.
+ */
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::save_functions
+( const system_type& system, id_type slot_id, std::ostream& stream )
+{
+  const slot_names& names( system.m_names[ slot_id ] );
+  easing_id id;
+
+  if ( system.m_parameterized_easings.has_value( slot_id ) )
+    {
+      const parameterized_easing< float_type >& e
+        ( system.m_parameterized_easings[ slot_id ] );
+
+      write< std::uint8_t >( stream, parameterized_transform );
+      write< std::uint8_t >( stream, static_cast< std::uint8_t >( e.id() ) );
+      write< float_type >( stream, e.first() );
+      write< float_type >( stream, e.second() );
+    }
+  else if ( system.m_easings.has_value( slot_id ) )
+    write< std::uint8_t >
+      ( stream,
+        static_cast< std::uint8_t >
+        ( system.m_easings[ slot_id ].identifier ) );
+  else if ( easing::find_id( names.transform, id ) )
+    write< std::uint8_t >( stream, static_cast< std::uint8_t >( id ) );
+  else
+    {
+      tweeners_confirm_contract
+        ( !names.transform.empty(),
+          "save_system(): the transform of a slot has no name." );
+
+      write< std::uint8_t >( stream, named_transform );
+      write_string( stream, names.transform );
+    }
+
+  tweeners_confirm_contract
+    ( !system.m_slot[ slot_id ].on_update || !names.update.empty(),
+      "save_system(): the update function of a slot has no name." );
+  tweeners_confirm_contract
+    ( !system.m_variables.has_value( slot_id ),
+      "save_system(): a slot is bound to a variable." );
+  tweeners_confirm_contract
+    ( !system.m_start_functions.has_value( slot_id )
+      || !names.on_start.empty(),
+      "save_system(): the start callback of a slot has no name." );
+  tweeners_confirm_contract
+    ( !system.m_done_functions.has_value( slot_id ) || !names.on_done.empty(),
+      "save_system(): the done callback of a slot has no name." );
+
+  write_string( stream, names.update );
+  write_string( stream, names.on_start );
+  write_string( stream, names.on_done );
+}
+
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::load_functions
+( system_type& system, id_type slot_id, std::istream& stream,
+  const registry_type& callbacks )
+{
+  slot_names names;
+  const std::uint8_t id( read< std::uint8_t >( stream ) );
+
+  if ( id == named_transform )
+    {
+      names.transform = read_string( stream );
+
+      const auto* const f( callbacks.find_transform( names.transform ) );
+      tweeners_confirm_contract
+        ( f != nullptr, "load_system(): unknown transform function." );
+
+      system.m_slot[ slot_id ].transform = *f;
+    }
+  else if ( id == parameterized_transform )
+    {
+      const std::uint8_t kind( read< std::uint8_t >( stream ) );
+      const float_type first( read< float_type >( stream ) );
+      const float_type second( read< float_type >( stream ) );
+
+      tweeners_confirm_contract
+        ( stream && ( kind < easing::parameterized_id_count ),
+          "load_system(): unknown parameterized easing." );
+
+      system.m_parameterized_easings.emplace
+        ( slot_id,
+          static_cast< parameterized_easing_id >( kind ), first, second );
+    }
+  else
+    {
+      tweeners_confirm_contract
+        ( id < easing::id_count, "load_system(): unknown easing." );
+
+      const easing_id e( static_cast< easing_id >( id ) );
+
+      names.transform = easing::name( e );
+      system.m_easings.emplace
+        ( slot_id,
+          easing_binding
+          { system_type::easing_precision::template function< float_type >
+            ( e ),
+            e } );
+    }
+
+  names.update = read_string( stream );
+  names.on_start = read_string( stream );
+  names.on_done = read_string( stream );
+
+  if ( !names.update.empty() )
+    {
+      const auto* const f( callbacks.find_update( names.update ) );
+      tweeners_confirm_contract
+        ( f != nullptr, "load_system(): unknown update function." );
+
+      system.m_slot[ slot_id ].on_update = *f;
+    }
+
+  if ( !names.on_start.empty() )
+    {
+      const auto* const f( callbacks.find_callback( names.on_start ) );
+      tweeners_confirm_contract
+        ( f != nullptr, "load_system(): unknown start callback." );
+
+      system.m_start_functions.emplace( slot_id, *f );
+    }
+
+  if ( !names.on_done.empty() )
+    {
+      const auto* const f( callbacks.find_callback( names.on_done ) );
+      tweeners_confirm_contract
+        ( f != nullptr, "load_system(): unknown done callback." );
+
+      system.m_done_functions.emplace( slot_id, *f );
+    }
+
+  system.m_names.emplace( slot_id, std::move( names ) );
+}
+
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::save_ids
+( const std::vector< id_type >& ids, std::ostream& stream )
+{
+  write< std::uint64_t >( stream, ids.size() );
+
+  for ( id_type id : ids )
+    write( stream, id );
+}
+
+/**
+ * \brief Get the identifiers of all the available slots: the ones in
+ *        m_available_ids, in the same order, followed by the ones given to
+ *        the command buffers.
+ */
+template< typename Config >
+std::vector< typename tweeners::detail::system_serializer< Config >::id_type >
+tweeners::detail::system_serializer< Config >::all_available_ids
+( const system_type& system )
+{
+  const std::size_t slot_count( system.m_slot_states.size() );
+  std::vector< id_type > result( system.m_available_ids );
+  std::vector< bool > listed( slot_count, false );
+
+  for ( id_type slot_id : result )
+    listed[ slot_id ] = true;
+
+  for ( std::size_t i( 0 ); i != slot_count; ++i )
+    if ( !listed[ i ]
+         && ( system.m_slot_states[ i ] == slot_state::available ) )
+      result.push_back( static_cast< id_type >( i ) );
+
+  return result;
+}
+
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::load_ids
+( const system_type& system, std::vector< id_type >& ids,
+  std::istream& stream )
+{
+  const std::uint64_t count( read< std::uint64_t >( stream ) );
+
+  tweeners_confirm_contract
+    ( count <= system.m_slot_states.size(),
+      "load_system(): invalid count of slots." );
+
+  ids.resize( count );
+
+  for ( id_type& id : ids )
+    id = load_id( system, stream );
+}
+
+template< typename Config >
+typename tweeners::detail::system_serializer< Config >::id_type
+tweeners::detail::system_serializer< Config >::load_id
+( const system_type& system, std::istream& stream )
+{
+  const id_type result( read< id_type >( stream ) );
+
+  tweeners_confirm_contract
+    ( ( result >= 0 )
+      && ( static_cast< std::size_t >( result )
+           < system.m_slot_states.size() ),
+      "load_system(): invalid slot identifier." );
+
+  return result;
+}
+
+/**
+ * \brief Verify that the loaded queues are consistent with the states of
+ * their slots.
+ *
+ * The slots to start must be ready or dead, the removed slots must be dead,
+ * the available identifiers must be available and the slots to update must be
+ * running or dead. Except for the removed slots, which may have been removed
+ * more than once, a slot appears at most once in a queue.
+ */
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::check_queues
+( const system_type& system )
+{
+  const std::size_t slot_count( system.m_slot_states.size() );
+
+  // Each queue marks its slots with its own value, such that the slots queued
+  // twice are found in a single pass. A slot marked by a queue may be marked
+  // again by the next ones.
+  std::vector< std::uint8_t > marks( slot_count, 0 );
+
+  check_queue
+    ( system, system.m_available_ids, slot_state::available,
+      slot_state::available, marks, 1 );
+
+  // The available slots cannot be in the next queues, thus they keep their
+  // mark.
+  for ( std::size_t i( 0 ); i != slot_count; ++i )
+    if ( system.m_slot_states[ i ] == slot_state::available )
+      tweeners_confirm_contract
+        ( marks[ i ] == 1,
+          "load_system(): an available slot is not in the available ids." );
+
+  check_queue
+    ( system, system.m_start_queue, slot_state::ready, slot_state::dead,
+      marks, 2 );
+  check_queue
+    ( system, system.m_need_update, slot_state::running, slot_state::dead,
+      marks, 3 );
+
+  for ( id_type slot_id : system.m_dead_queue )
+    tweeners_confirm_contract
+      ( system.m_slot_states[ slot_id ] == slot_state::dead,
+        "load_system(): a queued slot is in an invalid state." );
+}
+
+/**
+ * \brief Verify that the slots of a loaded queue are unique and in one of the
+ * given states.
+ *
+ * \param marks One entry per slot, set to mark for the slots of the queue.
+ * \param mark The value marking the slots of this queue, not used by the
+ *        previous queues.
+ */
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::check_queue
+( const system_type& system, const std::vector< id_type >& ids,
+  slot_state first_state, slot_state second_state,
+  std::vector< std::uint8_t >& marks, std::uint8_t mark )
+{
+  for ( id_type slot_id : ids )
+    {
+      const slot_state state( system.m_slot_states[ slot_id ] );
+
+      tweeners_confirm_contract
+        ( ( state == first_state ) || ( state == second_state ),
+          "load_system(): a queued slot is in an invalid state." );
+      tweeners_confirm_contract
+        ( marks[ slot_id ] != mark, "load_system(): a slot is queued twice." );
+
+      marks[ slot_id ] = mark;
+    }
+}
+
+/**
+ * \brief Verify that the successors and the predecessors of the loaded slots
+ * match.
+ *
+ * As in system_base::check_sequences_invariants(), the dead slots are being
+ * recycled and are not checked. For the other slots, each successor must
+ * designate the slot as its predecessor, and the predecessor of a slot must
+ * be an existing slot listing it once in its successors.
+ */
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::check_sequences
+( const system_type& system )
+{
+  const std::size_t slot_count( system.m_slot_states.size() );
+
+  // Non-zero for the slots listed in the successors of their predecessor.
+  std::vector< std::uint8_t > listed( slot_count, 0 );
+
+  for ( std::size_t i( 0 ); i != slot_count; ++i )
+    {
+      const id_type slot_id( static_cast< id_type >( i ) );
+
+      if ( system.m_successors.has_value( slot_id ) )
+        for ( id_type successor : system.m_successors[ slot_id ] )
+          if ( system.m_slot[ successor ].previous == slot_id )
+            {
+              tweeners_confirm_contract
+                ( listed[ successor ] == 0,
+                  "load_system(): a slot is not a successor of its"
+                  " predecessor." );
+              listed[ successor ] = 1;
+            }
+    }
+
+  for ( std::size_t i( 0 ); i != slot_count; ++i )
+    {
+      const slot_state state( system.m_slot_states[ i ] );
+
+      if ( ( state == slot_state::available ) || ( state == slot_state::dead ) )
+        continue;
+
+      const id_type slot_id( static_cast< id_type >( i ) );
+
+      if ( system.m_successors.has_value( slot_id ) )
+        for ( id_type successor : system.m_successors[ slot_id ] )
+          tweeners_confirm_contract
+            ( system.m_slot[ successor ].previous == slot_id,
+              "load_system(): a successor does not follow its slot." );
+
+      const id_type previous( system.m_slot[ slot_id ].previous );
+
+      if ( previous == system_type::not_an_id )
+        continue;
+
+      tweeners_confirm_contract
+        ( system.m_slot_states[ previous ] != slot_state::available,
+          "load_system(): a slot follows an available slot." );
+      tweeners_confirm_contract
+        ( listed[ slot_id ] != 0,
+          "load_system(): a slot is not a successor of its predecessor." );
+    }
+}
+
+template< typename Config >
+template< typename T >
+void tweeners::detail::system_serializer< Config >::write
+( std::ostream& stream, T value )
+{
+  static_assert
+    ( std::is_trivially_copyable< T >::value,
+      "The saved types must be trivially copyable." );
+
+  stream.write( reinterpret_cast< const char* >( &value ), sizeof( T ) );
+}
+
+template< typename Config >
+template< typename T >
+T tweeners::detail::system_serializer< Config >::read( std::istream& stream )
+{
+  static_assert
+    ( std::is_trivially_copyable< T >::value,
+      "The saved types must be trivially copyable." );
+
+  T result;
+  stream.read( reinterpret_cast< char* >( &result ), sizeof( T ) );
+
+  tweeners_confirm_contract
+    ( stream, "load_system(): unexpected end of data." );
+
+  return result;
+}
+
+template< typename Config >
+void tweeners::detail::system_serializer< Config >::write_string
+( std::ostream& stream, const std::string& s )
+{
+  write< std::uint32_t >( stream, static_cast< std::uint32_t >( s.size() ) );
+  stream.write( s.data(), s.size() );
+}
+
+template< typename Config >
+std::string
+tweeners::detail::system_serializer< Config >::read_string
+( std::istream& stream )
+{
+  std::string result( read< std::uint32_t >( stream ), '\0' );
+
+  if ( !result.empty() )
+    stream.read( &result[ 0 ], result.size() );
+
+  tweeners_confirm_contract
+    ( stream, "load_system(): unexpected end of data." );
+
+  return result;
+}
+
+#endif
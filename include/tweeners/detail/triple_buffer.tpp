@@ -0,0 +1,70 @@
+#ifndef TWEENERS_DETAIL_TRIPLE_BUFFER_TPP
+#define TWEENERS_DETAIL_TRIPLE_BUFFER_TPP
+
+template< typename T >
+tweeners::triple_buffer< T >::triple_buffer()
+  : m_back( 0 ),
+    m_middle( 1 ),
+    m_front( 2 )
+{
+
+}
+
+/**
+ * \brief Create the buffers with a copy of a given value, which is the value
+ *        returned by acquire_latest() until the first publication.
+ */
+template< typename T >
+tweeners::triple_buffer< T >::triple_buffer( const T& initial_value )
+  : m_buffers{ initial_value, initial_value, initial_value },
+    m_back( 0 ),
+    m_middle( 1 ),
+    m_front( 2 )
+{
+
+}
+
+/**
+ * \brief Get the buffer to fill before calling publish().
+ *
+ * The buffer contains an older value, published two or more times ago, which
+ * must be entirely overwritten. This function must be called by the writer
+ * thread only.
+ */
+template< typename T >
+T& tweeners::triple_buffer< T >::write_buffer()
+{
+  return m_buffers[ m_back ];
+}
+
+/**
+ * \brief Make the content of write_buffer() available to the reader.
+ *
+ * write_buffer() then returns another buffer. This function must be called by
+ * the writer thread only.
+ */
+template< typename T >
+void tweeners::triple_buffer< T >::publish()
+{
+  m_back =
+    m_middle.exchange( m_back | fresh_bit, std::memory_order_acq_rel )
+    & index_mask;
+}
+
+/**
+ * \brief Get the last published value.
+ *
+ * The returned value remains valid and unchanged until the next call to this
+ * function. This function must be called by the reader thread only.
+ */
+template< typename T >
+const T& tweeners::triple_buffer< T >::acquire_latest()
+{
+  if ( ( m_middle.load( std::memory_order_relaxed ) & fresh_bit ) != 0 )
+    m_front =
+      m_middle.exchange( m_front, std::memory_order_acq_rel ) & index_mask;
+
+  return m_buffers[ m_front ];
+}
+
+#endif
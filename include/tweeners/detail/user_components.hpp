@@ -0,0 +1,79 @@
+#ifndef TWEENERS_DETAIL_USER_COMPONENTS_HPP
+#define TWEENERS_DETAIL_USER_COMPONENTS_HPP
+
+#include <tweeners/detail/slot_component.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace tweeners
+{
+  namespace detail
+  {
+    /**
+     * \brief The components registered by the client code in a
+     *        tweeners::system, whatever their type.
+     *
+     * Each component is a slot_component, thus it must have as many entries as
+     * there are slots in the system. The values of the components are accessed
+     * by index, which is the order of registration.
+     */
+    template< typename Id >
+    class user_components
+    {
+    public:
+      user_components() = default;
+      user_components( const user_components& that );
+      user_components( user_components&& ) = default;
+
+      user_components& operator=( const user_components& that );
+      user_components& operator=( user_components&& ) = default;
+
+      template< typename T >
+      std::size_t add( T default_value, std::size_t slot_count );
+
+      template< typename T >
+      slot_component< T, Id >& get( std::size_t index );
+
+      template< typename T >
+      const slot_component< T, Id >& get( std::size_t index ) const;
+
+      template< typename T >
+      bool has_type( std::size_t index ) const;
+
+      void reserve( std::size_t slot_count, std::size_t value_count );
+      void add_one_slot_at_end();
+      void erase( const Id* first, const Id* last );
+
+    private:
+      /** \brief The operations of the system on a component of any type. */
+      class storage_base
+      {
+      public:
+        virtual ~storage_base() = default;
+
+        virtual std::unique_ptr< storage_base > clone() const = 0;
+
+        /**
+         * \brief A value unique to the type of the values in the storage.
+         */
+        virtual const void* type() const = 0;
+
+        virtual void reserve
+        ( std::size_t slot_count, std::size_t value_count ) = 0;
+        virtual void add_one_slot_at_end() = 0;
+        virtual void erase( const Id* first, const Id* last ) = 0;
+      };
+
+      template< typename T >
+      class storage;
+
+    private:
+      std::vector< std::unique_ptr< storage_base > > m_storages;
+    };
+  }
+}
+
+#include <tweeners/detail/user_components.tpp>
+
+#endif
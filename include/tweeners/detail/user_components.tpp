@@ -0,0 +1,166 @@
+#ifndef TWEENERS_DETAIL_USER_COMPONENTS_TPP
+#define TWEENERS_DETAIL_USER_COMPONENTS_TPP
+
+#include <tweeners/detail/debug.hpp>
+
+namespace tweeners
+{
+  namespace detail
+  {
+    /**
+     * \brief The address of type_tag< T >::value is unique to T.
+     */
+    template< typename T >
+    struct type_tag
+    {
+      static const char value;
+    };
+
+    template< typename T >
+    const char type_tag< T >::value = 0;
+  }
+}
+
+template< typename Id >
+template< typename T >
+class tweeners::detail::user_components< Id >::storage:
+  public storage_base
+{
+public:
+  explicit storage( T default_value )
+    : values( std::move( default_value ) )
+  {
+
+  }
+
+  std::unique_ptr< storage_base > clone() const override
+  {
+    return std::unique_ptr< storage_base >( new storage( *this ) );
+  }
+
+  const void* type() const override
+  {
+    return &type_tag< T >::value;
+  }
+
+  void reserve( std::size_t slot_count, std::size_t value_count ) override
+  {
+    values.reserve( slot_count, value_count );
+  }
+
+  void add_one_slot_at_end() override
+  {
+    values.add_one_slot_at_end();
+  }
+
+  void erase( const Id* first, const Id* last ) override
+  {
+    values.erase( first, last );
+  }
+
+public:
+  slot_component< T, Id > values;
+};
+
+template< typename Id >
+tweeners::detail::user_components< Id >::user_components
+( const user_components& that )
+{
+  m_storages.reserve( that.m_storages.size() );
+
+  for ( const std::unique_ptr< storage_base >& s : that.m_storages )
+    m_storages.emplace_back( s->clone() );
+}
+
+template< typename Id >
+tweeners::detail::user_components< Id >&
+tweeners::detail::user_components< Id >::operator=
+( const user_components& that )
+{
+  if ( this != &that )
+    *this = user_components( that );
+
+  return *this;
+}
+
+/**
+ * \brief Create a new component.
+ *
+ * \param default_value The value of the component for the slots having no
+ *        specific value.
+ *
+ * \param slot_count The number of slots in the system.
+ *
+ * \return The index of the new component, to be passed to get().
+ */
+template< typename Id >
+template< typename T >
+std::size_t tweeners::detail::user_components< Id >::add
+( T default_value, std::size_t slot_count )
+{
+  storage< T >* const s( new storage< T >( std::move( default_value ) ) );
+  m_storages.emplace_back( s );
+
+  for ( std::size_t i( 0 ); i != slot_count; ++i )
+    s->values.add_one_slot_at_end();
+
+  return m_storages.size() - 1;
+}
+
+template< typename Id >
+template< typename T >
+tweeners::detail::slot_component< T, Id >&
+tweeners::detail::user_components< Id >::get( std::size_t index )
+{
+  tweeners_debug_assert( has_type< T >( index ) );
+
+  return static_cast< storage< T >& >( *m_storages[ index ] ).values;
+}
+
+template< typename Id >
+template< typename T >
+const tweeners::detail::slot_component< T, Id >&
+tweeners::detail::user_components< Id >::get( std::size_t index ) const
+{
+  tweeners_debug_assert( has_type< T >( index ) );
+
+  return static_cast< const storage< T >& >( *m_storages[ index ] ).values;
+}
+
+/**
+ * \brief Tell if the component at the given index exists and stores values of
+ *        type T.
+ */
+template< typename Id >
+template< typename T >
+bool tweeners::detail::user_components< Id >::has_type
+( std::size_t index ) const
+{
+  return ( index < m_storages.size() )
+    && ( m_storages[ index ]->type() == &type_tag< T >::value );
+}
+
+template< typename Id >
+void tweeners::detail::user_components< Id >::reserve
+( std::size_t slot_count, std::size_t value_count )
+{
+  for ( const std::unique_ptr< storage_base >& s : m_storages )
+    s->reserve( slot_count, value_count );
+}
+
+template< typename Id >
+void tweeners::detail::user_components< Id >::add_one_slot_at_end()
+{
+  for ( const std::unique_ptr< storage_base >& s : m_storages )
+    s->add_one_slot_at_end();
+}
+
+template< typename Id >
+void tweeners::detail::user_components< Id >::erase
+( const Id* first, const Id* last )
+{
+  for ( const std::unique_ptr< storage_base >& s : m_storages )
+    s->erase( first, last );
+}
+
+#endif
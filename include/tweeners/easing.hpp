@@ -1,6 +1,10 @@
 #ifndef TWEENERS_EASING_HPP
 #define TWEENERS_EASING_HPP
 
+#include <cstddef>
+#include <memory>
+#include <vector>
+
 namespace tweeners
 {
   namespace easing
@@ -10,6 +14,28 @@ namespace tweeners
 
     template< typename Float, typename Easing >
     Float ease_in_out( Float t, Easing&& function );
+
+    template< typename Float, Float ( *Function )( Float ) >
+    Float out( Float t );
+
+    template< typename Float, Float ( *Function )( Float ) >
+    Float in_out( Float t );
+
+    template
+    <
+      typename Float,
+      Float ( *Function )( Float ),
+      std::size_t Resolution = 256
+    >
+    Float tabulated( Float t );
+
+    template
+    <
+      typename Float,
+      Float ( *Function )( Float ),
+      std::size_t Resolution = 256
+    >
+    Float tabulated_max_error();
     
     template< typename Float = float >
     Float none( Float t );
@@ -46,6 +72,76 @@ namespace tweeners
 
     template< typename Float = float >
     Float back( Float t );
+
+    template< typename Float = float >
+    Float elastic_with( Float t, Float amplitude, Float period );
+
+    template< typename Float = float >
+    Float back_with( Float t, Float overshoot );
+
+    template< typename Float = float >
+    Float steps( Float t, Float count );
+
+    template< typename Float = float >
+    Float power( Float t, Float exponent );
+
+    template< typename Float = float >
+    Float fast_sine( Float t );
+
+    template< typename Float = float >
+    Float fast_circ( Float t );
+
+    template< typename Float = float >
+    Float fast_expo( Float t );
+
+    template< typename Float = float >
+    Float fast_elastic( Float t );
+
+    /**
+     * \brief A curve given by sampled points, for example exported from an
+     *        animation tool.
+     *
+     * The points are joined by a monotone cubic interpolation, as described
+     * by Fritsch and Carlson, such that the curve does not overshoot between
+     * the points: it is monotonic wherever the points are. The curve is
+     * evaluated once for evenly spaced ratios when the easing is created,
+     * then the evaluation is a linear interpolation in this table, without
+     * searching the points.
+     *
+     * The table is immutable and shared by the copies of the easing, thus
+     * many slots can use the same curve for the cost of a pointer each.
+     */
+    template< typename Float = float >
+    class sampled_curve
+    {
+    public:
+      /** \brief A sampled point of the curve. */
+      struct point
+      {
+        /** \brief The ratio of the duration, in [0, 1]. */
+        Float x;
+
+        /** \brief The value of the easing at x. */
+        Float y;
+      };
+
+    public:
+      explicit sampled_curve
+      ( const std::vector< point >& points, std::size_t resolution = 256 );
+
+      Float operator()( Float t ) const;
+
+    private:
+      static std::vector< Float > monotone_tangents
+      ( const std::vector< point >& points );
+
+    private:
+      /**
+       * \brief The values of the curve at the ratios i / ( size() - 1 ), at
+       *        index i.
+       */
+      std::shared_ptr< const std::vector< Float > > m_values;
+    };
   }
 }
 
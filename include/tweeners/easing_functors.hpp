@@ -0,0 +1,135 @@
+#ifndef TWEENERS_EASING_FUNCTORS_HPP
+#define TWEENERS_EASING_FUNCTORS_HPP
+
+#include <tweeners/easing_id.hpp>
+
+#include <ratio>
+#include <type_traits>
+
+#define tweeners_declare_easing_functor( f, specifier )                 \
+  struct f ## _t                                                        \
+  {                                                                     \
+    template< typename Float >                                          \
+    specifier Float operator()( Float t ) const;                        \
+  }
+
+namespace tweeners
+{
+  namespace easing
+  {
+    /*
+     * Stateless function objects equivalent to the functions of the same name
+     * without the _t suffix. Being types, they can be combined at compile
+     * time with the templates below, and the compiler can inline the
+     * resulting curve as a whole.
+     *
+     * The polynomial ones are usable in constant expressions.
+     *
+     * Note that quad_t is ambiguous with ::quad_t from <sys/types.h> after a
+     * using-directive, thus it should be qualified.
+     */
+    tweeners_declare_easing_functor( none, constexpr );
+    tweeners_declare_easing_functor( linear, constexpr );
+    tweeners_declare_easing_functor( sine, );
+    tweeners_declare_easing_functor( quad, constexpr );
+    tweeners_declare_easing_functor( cubic, constexpr );
+    tweeners_declare_easing_functor( quart, constexpr );
+    tweeners_declare_easing_functor( quint, constexpr );
+    tweeners_declare_easing_functor( circ, );
+    tweeners_declare_easing_functor( expo, );
+    tweeners_declare_easing_functor( elastic, );
+    tweeners_declare_easing_functor( bounce, );
+    tweeners_declare_easing_functor( back, constexpr );
+
+    /** \brief The composition of ease_out() with Easing. */
+    template< typename Easing >
+    struct ease_out_t
+    {
+      template< typename Float >
+      constexpr Float operator()( Float t ) const;
+    };
+
+    /** \brief The composition of ease_in_out() with Easing. */
+    template< typename Easing >
+    struct ease_in_out_t
+    {
+      template< typename Float >
+      constexpr Float operator()( Float t ) const;
+    };
+
+    /**
+     * \brief Easing played forward on the first half of the ratios, then
+     *        backward on the second half, thus ending where it started.
+     */
+    template< typename Easing >
+    struct mirror
+    {
+      template< typename Float >
+      constexpr Float operator()( Float t ) const;
+    };
+
+    /**
+     * \brief Second applied to the result of First. The result of First must
+     *        be in [0, 1].
+     */
+    template< typename First, typename Second >
+    struct chain
+    {
+      template< typename Float >
+      constexpr Float operator()( Float t ) const;
+    };
+
+    /** \brief The result of Easing multiplied by the std::ratio Ratio. */
+    template< typename Easing, typename Ratio >
+    struct scale
+    {
+      template< typename Float >
+      constexpr Float operator()( Float t ) const;
+    };
+
+    /** \brief The result of Easing bounded to [0, 1]. */
+    template< typename Easing >
+    struct clamp
+    {
+      template< typename Float >
+      constexpr Float operator()( Float t ) const;
+    };
+
+    /**
+     * \brief The weighted average of First and Second, where the std::ratio
+     *        Weight is the weight of Second.
+     */
+    template
+    <
+      typename First,
+      typename Second,
+      typename Weight = std::ratio< 1, 2 >
+    >
+    struct blend
+    {
+      template< typename Float >
+      constexpr Float operator()( Float t ) const;
+    };
+
+    /**
+     * \brief Tells if a function object is equivalent to an easing function
+     *        with an identifier, given by easing_id_of< Easing >::value.
+     *
+     * This is true for the functors of the built-in easings and for their
+     * composition with ease_out_t and ease_in_out_t.
+     */
+    template< typename Easing >
+    struct has_easing_id:
+      std::false_type
+    {};
+
+    template< typename Easing >
+    struct easing_id_of;
+  }
+}
+
+#undef tweeners_declare_easing_functor
+
+#include <tweeners/detail/easing_functors.tpp>
+
+#endif
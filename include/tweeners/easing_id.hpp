@@ -0,0 +1,79 @@
+#ifndef TWEENERS_EASING_ID_HPP
+#define TWEENERS_EASING_ID_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace tweeners
+{
+  /**
+   * \brief Stable identifiers of the functions from tweeners/easing.hpp, for
+   *        storage in files.
+   *
+   * The identifiers without suffix are the ease-in functions. The _out and
+   * _in_out suffixes designate their composition with easing::ease_out() and
+   * easing::ease_in_out(). The values must never change.
+   */
+  enum class easing_id : std::uint8_t
+  {
+    none,
+    linear,
+    sine, sine_out, sine_in_out,
+    quad, quad_out, quad_in_out,
+    cubic, cubic_out, cubic_in_out,
+    quart, quart_out, quart_in_out,
+    quint, quint_out, quint_in_out,
+    circ, circ_out, circ_in_out,
+    expo, expo_out, expo_in_out,
+    elastic, elastic_out, elastic_in_out,
+    bounce, bounce_out, bounce_in_out,
+    back, back_out, back_in_out
+  };
+
+  namespace easing
+  {
+    /** \brief The number of values in tweeners::easing_id. */
+    constexpr std::size_t id_count = 32;
+
+    const char* name( easing_id id );
+    bool find_id( const std::string& name, easing_id& id );
+
+    template< typename Float = float >
+    Float ( *function( easing_id id ) )( Float );
+
+    template< typename Float = float, std::size_t Resolution = 256 >
+    Float ( *tabulated_function( easing_id id ) )( Float );
+
+    template< typename Float = float >
+    Float ( *fast_function( easing_id id ) )( Float );
+
+    /**
+     * \brief Precision policy selecting the easing functions from
+     *        tweeners/easing.hpp.
+     *
+     * \sa config::easing_precision.
+     */
+    struct precise
+    {
+      template< typename Float >
+      static Float ( *function( easing_id id ) )( Float );
+    };
+
+    /**
+     * \brief Precision policy selecting the approximations of the easings
+     *        calling the math library, as returned by fast_function().
+     *
+     * \sa config::easing_precision.
+     */
+    struct fast
+    {
+      template< typename Float >
+      static Float ( *function( easing_id id ) )( Float );
+    };
+  }
+}
+
+#include <tweeners/detail/easing_id.tpp>
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef TWEENERS_KEYFRAME_TRACK_HPP
+#define TWEENERS_KEYFRAME_TRACK_HPP
+
+#include <tweeners/easing_id.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace tweeners
+{
+  /**
+   * \brief A sequence of values reached at given times, played by a single
+   *        slot.
+   *
+   * Animating through many keyframes with one slot per pair of keys costs a
+   * slot, a completion and a restart per key. A track is played by a single
+   * slot whose update function keeps the index of the current pair of keys
+   * and moves it forward as the time goes.
+   *
+   * The track must outlive the slots playing it. It can be shared by many
+   * slots.
+   *
+   * \sa builder_base::keyframes.
+   */
+  template< typename Float = float >
+  class keyframe_track
+  {
+  public:
+    /** \brief A value of the track. */
+    struct key
+    {
+      /** \brief The date at which the value is reached. */
+      Float time;
+
+      Float value;
+
+      /**
+       * \brief The transform applied to reach the value from the previous
+       *        key.
+       */
+      easing_id easing;
+    };
+
+  public:
+    explicit keyframe_track( const std::vector< key >& keys );
+
+    Float duration() const;
+    Float value( Float ratio, std::size_t& cursor ) const;
+
+  private:
+    /** \brief The interpolation between two consecutive keys. */
+    struct segment
+    {
+      /** \brief The ratio of the duration at which the segment begins. */
+      Float begin;
+
+      /** \brief The inverse of the length of the segment, in ratio. */
+      Float inverse_length;
+
+      Float from;
+      Float delta;
+
+      Float ( *transform )( Float );
+    };
+
+  private:
+    /** \brief The segments, in the order of their dates. */
+    std::vector< segment > m_segments;
+
+    /** \brief The date of the last key. */
+    Float m_duration;
+  };
+
+  namespace detail
+  {
+    /**
+     * \brief The update function of a slot playing a keyframe_track. It
+     *        passes the value of the track to another update function.
+     */
+    template< typename Float, typename Update >
+    class keyframe_cursor
+    {
+    public:
+      keyframe_cursor( const keyframe_track< Float >& track, Update update );
+
+      void operator()( Float ratio );
+
+    private:
+      const keyframe_track< Float >* m_track;
+      Update m_update;
+
+      /** \brief The index of the current segment in the track. */
+      std::size_t m_cursor;
+    };
+  }
+}
+
+#include <tweeners/detail/keyframe_track.tpp>
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef TWEENERS_OUTPUT_BUFFER_HPP
+#define TWEENERS_OUTPUT_BUFFER_HPP
+
+#include <cstddef>
+
+namespace tweeners
+{
+  template< typename Config >
+  class system_base;
+
+  /**
+   * \brief Handle to an array receiving the values of the slots of a
+   *        tweeners::system.
+   *
+   * A default constructed handle designates the buffer owned by the system,
+   * indexed by slot identifier. The other handles are returned by
+   * system_base::add_output_buffer().
+   *
+   * The handle is valid only for the system that created it.
+   *
+   * \sa system_base::bind_output.
+   */
+  class output_buffer
+  {
+    template< typename Config >
+    friend class system_base;
+
+  public:
+    output_buffer()
+      : m_index( 0 )
+    {
+
+    }
+
+  private:
+    explicit output_buffer( std::size_t index )
+      : m_index( index )
+    {
+
+    }
+
+  private:
+    /** \brief The index of the buffer in the system's storage. */
+    std::size_t m_index;
+  };
+
+  /**
+   * \brief A range [begin, end) of entries of an output buffer.
+   */
+  struct output_range
+  {
+    std::size_t begin;
+    std::size_t end;
+  };
+}
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef TWEENERS_OVERWRITE_POLICY_HPP
+#define TWEENERS_OVERWRITE_POLICY_HPP
+
+namespace tweeners
+{
+  /**
+   * \brief What to do when a tweener is created for a target already updated
+   *        by another tweener.
+   *
+   * \sa system_base::bind_target.
+   */
+  enum class overwrite_policy
+  {
+    /** \brief Both tweeners update the target. */
+    keep_both,
+
+    /** \brief The existing tweener is removed. */
+    replace_existing,
+
+    /** \brief The new tweener starts when the existing one is done. */
+    queue_after
+  };
+}
+
+#endif
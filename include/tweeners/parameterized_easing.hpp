@@ -0,0 +1,80 @@
+#ifndef TWEENERS_PARAMETERIZED_EASING_HPP
+#define TWEENERS_PARAMETERIZED_EASING_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tweeners
+{
+  /**
+   * \brief Stable identifiers of the kinds of parameterized_easing, for
+   *        storage in files.
+   *
+   * The identifiers without suffix are the ease-in functions. The _out and
+   * _in_out suffixes designate their composition with easing::ease_out() and
+   * easing::ease_in_out(). The values must never change.
+   */
+  enum class parameterized_easing_id : std::uint8_t
+  {
+    elastic, elastic_out, elastic_in_out,
+    back, back_out, back_in_out,
+    steps,
+    power, power_out, power_in_out
+  };
+
+  namespace easing
+  {
+    /** \brief The number of values in tweeners::parameterized_easing_id. */
+    constexpr std::size_t parameterized_id_count = 10;
+  }
+
+  /**
+   * \brief An easing whose curve is tuned by parameters, stored by value.
+   *
+   * Tuning elastic() or back() otherwise requires a capturing lambda, which is
+   * stored in a function object and is opaque to the system. An instance of
+   * this class is made of the identifier of its kind and of its parameters
+   * only, thus the system stores it per slot and evaluates it directly, as it
+   * does for the easings designated by an easing_id.
+   *
+   * The parameters are, by kind:
+   *  - elastic: the amplitude and the period of the oscillations,
+   *    \sa easing::elastic_with,
+   *  - back: the overshoot, \sa easing::back_with,
+   *  - steps: the number of steps, \sa easing::steps,
+   *  - power: the exponent, \sa easing::power.
+   *
+   * \sa builder_base::range_transform, system_base::configure_slot.
+   */
+  template< typename Float = float >
+  class parameterized_easing
+  {
+  public:
+    parameterized_easing();
+    parameterized_easing
+    ( parameterized_easing_id id, Float first, Float second = 0 );
+
+    parameterized_easing_id id() const;
+    Float first() const;
+    Float second() const;
+
+    Float operator()( Float t ) const;
+
+  private:
+    Float ease_in( Float t ) const;
+
+  private:
+    parameterized_easing_id m_id;
+
+    /**
+     * \brief The parameters passed to the constructor, followed by the ones
+     *        derived from them, such that the evaluation does not recompute
+     *        them.
+     */
+    Float m_parameters[ 3 ];
+  };
+}
+
+#include <tweeners/detail/parameterized_easing.tpp>
+
+#endif
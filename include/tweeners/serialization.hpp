@@ -0,0 +1,22 @@
+#ifndef TWEENERS_SERIALIZATION_HPP
+#define TWEENERS_SERIALIZATION_HPP
+
+#include <tweeners/callback_registry.hpp>
+#include <tweeners/system.hpp>
+
+#include <iosfwd>
+
+namespace tweeners
+{
+  template< typename Config >
+  void save_system( const system_base< Config >& system, std::ostream& stream );
+
+  template< typename Config >
+  void load_system
+  ( system_base< Config >& system, std::istream& stream,
+    const callback_registry_base< Config >& callbacks );
+}
+
+#include <tweeners/detail/serialization.tpp>
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef TWEENERS_SLOT_NAMES_HPP
+#define TWEENERS_SLOT_NAMES_HPP
+
+#include <string>
+
+namespace tweeners
+{
+  /**
+   * \brief The names under which the functions of a slot are registered in a
+   *        tweeners::callback_registry, such that the slot can be saved and
+   *        loaded.
+   *
+   * An empty name means that the slot has no such function. The transform can
+   * also be the name of a built-in easing, see tweeners::easing::name().
+   *
+   * \sa system_base::set_slot_names, tweeners::save_system.
+   */
+  struct slot_names
+  {
+    std::string update;
+    std::string transform;
+    std::string on_start;
+    std::string on_done;
+  };
+}
+
+#endif
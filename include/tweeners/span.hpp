@@ -0,0 +1,104 @@
+#ifndef TWEENERS_SPAN_HPP
+#define TWEENERS_SPAN_HPP
+
+#include <cstddef>
+
+namespace tweeners
+{
+  /**
+   * \brief A view on a contiguous sequence of values.
+   *
+   * This is a minimal replacement for std::span, which is not available in
+   * the standard targeted by the library. The span does not own the values,
+   * thus they must outlive it.
+   */
+  template< typename T >
+  class span
+  {
+  public:
+    using value_type = T;
+    using iterator = T*;
+
+  public:
+    span()
+      : m_data( nullptr ),
+        m_size( 0 )
+    {
+
+    }
+
+    span( T* data, std::size_t size )
+      : m_data( data ),
+        m_size( size )
+    {
+
+    }
+
+    T* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    iterator begin() const { return m_data; }
+    iterator end() const { return m_data + m_size; }
+
+    T& operator[]( std::size_t i ) const { return m_data[ i ]; }
+
+  private:
+    T* m_data;
+    std::size_t m_size;
+  };
+
+  /**
+   * \brief A view on values separated by a constant distance, for example a
+   *        member of the elements of an array of structures.
+   *
+   * The stride is the distance between two consecutive values, in units of
+   * T, thus the distance between the elements must be a multiple of the size
+   * of T. The span does not own the values, thus they must outlive it.
+   */
+  template< typename T >
+  class strided_span
+  {
+  public:
+    using value_type = T;
+
+  public:
+    strided_span()
+      : m_data( nullptr ),
+        m_size( 0 ),
+        m_stride( 1 )
+    {
+
+    }
+
+    strided_span( T* data, std::size_t size, std::size_t stride = 1 )
+      : m_data( data ),
+        m_size( size ),
+        m_stride( stride )
+    {
+
+    }
+
+    strided_span( span< T > values )
+      : m_data( values.data() ),
+        m_size( values.size() ),
+        m_stride( 1 )
+    {
+
+    }
+
+    T* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+    std::size_t stride() const { return m_stride; }
+    bool empty() const { return m_size == 0; }
+
+    T& operator[]( std::size_t i ) const { return m_data[ i * m_stride ]; }
+
+  private:
+    T* m_data;
+    std::size_t m_size;
+    std::size_t m_stride;
+  };
+}
+
+#endif
@@ -1,13 +1,44 @@
 #ifndef TWEENERS_SYSTEM_HPP
 #define TWEENERS_SYSTEM_HPP
 
+#include <tweeners/component.hpp>
 #include <tweeners/config.hpp>
+#include <tweeners/easing_id.hpp>
+#include <tweeners/output_buffer.hpp>
+#include <tweeners/overwrite_policy.hpp>
+#include <tweeners/parameterized_easing.hpp>
+#include <tweeners/slot_names.hpp>
+#include <tweeners/span.hpp>
+#include <tweeners/triple_buffer.hpp>
+#include <tweeners/update_group.hpp>
+#include <tweeners/detail/command_queue.hpp>
+#include <tweeners/detail/config_traits.hpp>
 #include <tweeners/detail/slot_component.hpp>
+#include <tweeners/detail/slot_waiters.hpp>
+#include <tweeners/detail/user_components.hpp>
 
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 namespace tweeners
 {
+  class clip;
+  struct clip_bindings;
+
+  template< typename Config >
+  class command_buffer_base;
+
+  template< typename Config >
+  class slot_awaiter;
+
+  namespace detail
+  {
+    template< typename Config >
+    class system_serializer;
+  }
+
   /**
    * \brief The system handles the progression of the tweeners.
    *
@@ -24,10 +55,17 @@ namespace tweeners
   template< typename Config = config<> >
   class system_base
   {
+    friend class command_buffer_base< Config >;
+    friend class slot_awaiter< Config >;
+    friend class detail::system_serializer< Config >;
+
   public:
     using duration_type = typename Config::duration_type;
     using id_type = typename Config::id_type;
     using float_type = typename Config::float_type;
+    using tag_type = typename detail::config_tag_type< Config >::type;
+    using easing_precision =
+      typename detail::config_easing_precision< Config >::type;
 
     template< typename Signature >
     using function_type = typename Config::template function_type< Signature >;
@@ -37,6 +75,20 @@ namespace tweeners
 
     using void_function = function_type< void() >;
 
+    using output_snapshots = triple_buffer< std::vector< float_type > >;
+
+    /** \brief The value of a slot passed to the callback of its group. */
+    struct group_entry
+    {
+      /** \brief The key passed to bind_group(). */
+      std::size_t key;
+      float_type value;
+    };
+
+    using group_function = function_type< void( span< const group_entry > ) >;
+
+    class timing_snapshot;
+
   public:
     system_base();
 
@@ -47,6 +99,11 @@ namespace tweeners
     id_type configure_slot
     ( duration_type duration, update_function update,
       transform_function transform );
+    id_type configure_slot
+    ( duration_type duration, update_function update, easing_id easing );
+    id_type configure_slot
+    ( duration_type duration, update_function update,
+      const parameterized_easing< float_type >& easing );
 
     void start_slot( id_type slot_id );
 
@@ -57,6 +114,74 @@ namespace tweeners
     
     void remove_slot( id_type slot_id );
 
+    void pause_slot( id_type slot_id );
+    void resume_slot( id_type slot_id );
+
+    id_type bind_target
+    ( id_type slot_id, const void* target, overwrite_policy policy );
+
+    void tag_slot( id_type slot_id, tag_type tag );
+    void set_slot_names( id_type slot_id, slot_names names );
+
+    void remove_tagged( tag_type tag );
+    void pause_tagged( tag_type tag );
+    void resume_tagged( tag_type tag );
+
+    template< typename F >
+    void for_each_tagged( tag_type tag, F&& f ) const;
+
+    template< typename T >
+    component< T > register_component( T default_value = T() );
+
+    template< typename T, typename... Args >
+    void set_component( component< T > c, id_type slot_id, Args&&... value );
+
+    template< typename T >
+    bool has_component( component< T > c, id_type slot_id ) const;
+
+    template< typename T >
+    const T& get_component( component< T > c, id_type slot_id ) const;
+
+    template< typename T >
+    span< T > component_values( component< T > c );
+
+    template< typename T >
+    span< const id_type > component_slots( component< T > c ) const;
+
+    output_buffer add_output_buffer
+    ( float_type* values, std::size_t count, std::size_t stride = 1 );
+
+    void bind_variable
+    ( id_type slot_id, float_type from, float_type to, float_type& variable );
+
+    void bind_output( id_type slot_id, float_type from, float_type to );
+    void bind_output
+    ( id_type slot_id, float_type from, float_type to, output_buffer buffer,
+      std::size_t index );
+
+    span< const float_type > output_values() const;
+    span< const output_range >
+    dirty_ranges( output_buffer buffer = output_buffer() ) const;
+
+    void publish_outputs( output_snapshots* snapshots );
+
+    update_group register_update_group( group_function callback );
+    void bind_group
+    ( id_type slot_id, float_type from, float_type to, update_group group );
+    void bind_group
+    ( id_type slot_id, float_type from, float_type to, update_group group,
+      std::size_t key );
+
+    std::vector< id_type >
+    instantiate( const clip& c, const clip_bindings& bindings );
+
+    void save_timing( timing_snapshot& snapshot ) const;
+    void restore_timing( const timing_snapshot& snapshot );
+
+    std::size_t running_count() const;
+
+    slot_awaiter< Config > done( id_type slot_id );
+
     void update( duration_type step );
 
   public:
@@ -74,33 +199,148 @@ namespace tweeners
 
     struct tweener_state
     {
-      duration_type end_date;
-
       id_type previous;
-      
       transform_function transform;
       function_type< void( float_type ) > on_update;
     };
 
+    /** \brief The transform of a slot configured with a built-in easing. */
+    struct easing_binding
+    {
+      float_type ( *function )( float_type );
+
+      /** \brief The identifier of function, such that the slot can be saved. */
+      easing_id identifier;
+    };
+
+    /**
+     * \brief The variable receiving the values of a slot, as assigned by
+     *        bind_variable().
+     */
+    struct variable_binding
+    {
+      float_type* variable;
+      float_type from;
+      float_type to;
+    };
+
+    /**
+     * \brief The destination of the values of a slot bound to an output or to
+     *        a group.
+     */
+    struct output_binding
+    {
+      float_type from;
+      float_type to;
+
+      /**
+       * \brief The index of the buffer in m_output_buffers, or of the group in
+       *        m_update_groups if grouped is true.
+       */
+      std::size_t buffer;
+
+      /**
+       * \brief The index of the entry in the buffer, or the key passed to the
+       *        group.
+       */
+      std::size_t index;
+
+      bool grouped;
+    };
+
+    /** \brief A callback receiving the values of many slots. */
+    struct group_storage
+    {
+      group_function callback;
+
+      /** \brief The values collected during the current pass. */
+      std::vector< group_entry > entries;
+    };
+
+    /** \brief A buffer receiving the values of the slots. */
+    struct output_storage
+    {
+      /** \brief The first entry of the buffer. */
+      float_type* values;
+
+      /** \brief The number of entries in the buffer. */
+      std::size_t count;
+
+      /** \brief The distance between two entries, in float_type units. */
+      std::size_t stride;
+
+      /**
+       * \brief One bit per entry, set for the entries written during the
+       *        current update, such that the dirty ranges are collected in
+       *        order without sorting the writes.
+       */
+      std::vector< std::uint64_t > written;
+
+      /** \brief The range of the words of written having some bits set. */
+      std::size_t written_begin;
+      std::size_t written_end;
+
+      /** \brief The ranges of entries written during the last update. */
+      std::vector< output_range > dirty;
+    };
+
     typedef std::vector< id_type > successor_vector;
+
+    /**
+     * \brief The type of the position of a slot in the slots of its tag,
+     *        lower than the number of slots.
+     */
+    using tag_index_type = typename std::make_unsigned< id_type >::type;
     
     using id_iterator = typename std::vector< id_type >::iterator;
     
   private:
+    void apply_commands();
+    void apply_command
+    ( detail::command_batch< Config >& b,
+      const typename detail::command_batch< Config >::command& c );
+    void discard_failed_command
+    ( const detail::command_batch< Config >* batches,
+      const typename detail::command_batch< Config >::command& c );
+
     id_type create_slot();
+    void grow_slots( std::size_t slot_count );
+    void initialize_slot
+    ( id_type slot_id, duration_type duration, update_function update,
+      transform_function transform );
+    void initialize_slot
+    ( id_type slot_id, duration_type duration, update_function update,
+      easing_id easing );
+    void initialize_slot
+    ( id_type slot_id, duration_type duration, update_function update,
+      const parameterized_easing< float_type >& easing );
     bool is_valid_slot_id( id_type slot_id ) const;
     
-    void update_current_date( duration_type step );
     void start_slots( std::vector< id_type >& queue );
-    void update_running_slots( std::size_t from );
-    void update_tweener( id_type slot_id );
+    void update_running_slots( id_type from, duration_type step );
+    void compute_update_ratios( id_type from, duration_type step );
+    void update_tweener( id_type slot_id, float_type ratio, bool completed );
+    float_type transform_ratio
+    ( id_type slot_id, const tweener_state& tweener, float_type ratio ) const;
+    void emplace_output( id_type slot_id, const output_binding& binding );
+    void write_output( id_type slot_id, float_type ratio );
+    void reset_output_buffers();
+    void collect_dirty_ranges();
+    void publish_output_snapshot();
+    void call_update_groups();
     void complete_slot
     ( id_type slot_id, duration_type successors_current_date );
-    void stop_completed_slots();
+    void stop_completed_slots( id_type from );
 
     void remove_dead_slots();
+    void release_dead_slots();
+    bool remove_slots_created_since( const timing_snapshot& snapshot );
+    void change_structure();
     void remove_from_predecessor_successors
     ( id_type predecessor_id, id_type successor_id );
+    void add_to_tagged_slots( id_type slot_id, tag_type tag );
+    void remove_from_tagged_slots( id_type slot_id );
+    void unbind_target( id_type slot_id );
 
     void remove_ids
     ( std::vector< id_type >& ids, id_iterator first,
@@ -110,6 +350,8 @@ namespace tweeners
     void check_update_queue_invariants() const;
     void check_sequences_invariants() const;
     void check_available_ids() const;
+    void check_tags_invariants() const;
+    void check_targets_invariants() const;
     
   private:
     /**
@@ -142,6 +384,9 @@ namespace tweeners
      *
      * A slot id is a valid direct index in m_slot_states, m_slot,
      * m_current_dates.
+     *
+     * The available slots whose ids have been given to the command buffers
+     * are not in this vector.
      */
     std::vector< id_type > m_available_ids;
 
@@ -158,14 +403,226 @@ namespace tweeners
     std::vector< tweener_state > m_slot;
     std::vector< duration_type > m_current_dates;
 
+    /**
+     * \brief The duration of each slot. They are stored apart from m_slot,
+     *        such that the ratios of the progression of the slots are
+     *        computed from two contiguous arrays.
+     */
+    std::vector< duration_type > m_end_dates;
+
+    /**
+     * \brief Non-zero for each slot whose progression is suspended.
+     *
+     * The flags are stored as bytes rather than in a std::vector< bool >, such
+     * that compute_update_ratios() reads them without bit manipulations.
+     *
+     * \sa pause_slot.
+     */
+    std::vector< std::uint8_t > m_paused;
+
     detail::slot_component< void_function, id_type > m_start_functions;
     detail::slot_component< void_function, id_type > m_done_functions;
     detail::slot_component< successor_vector, id_type > m_successors;
 
+    /** \brief The tag of each slot, as assigned by tag_slot(). */
+    detail::slot_component< tag_type, id_type > m_tags;
+
+    /**
+     * \brief The index of each tagged slot in the entry of its tag in
+     *        m_tagged_slots, such that it is removed in constant time.
+     */
+    detail::slot_component< tag_index_type, id_type > m_tag_indices;
+
+    /**
+     * \brief The names of the functions of each slot, as assigned by
+     *        set_slot_names().
+     */
+    detail::slot_component< slot_names, id_type > m_names;
+
+    /** \brief The target of each slot, as assigned by bind_target(). */
+    detail::slot_component< const void*, id_type > m_targets;
+
+    /**
+     * \brief The coroutines waiting for the completion of each slot.
+     *
+     * \sa slot_awaiter.
+     */
+    detail::slot_waiters< id_type > m_waiters;
+
+    /**
+     * \brief The easing of each slot configured with a parameterized_easing,
+     *        called instead of the transform.
+     */
+    detail::slot_component< parameterized_easing< float_type >, id_type >
+    m_parameterized_easings;
+
+    /**
+     * \brief The easing of each slot configured with a built-in easing,
+     *        called directly instead of the transform.
+     */
+    detail::slot_component< easing_binding, id_type > m_easings;
+
+    /**
+     * \brief The variable of each slot bound with bind_variable(), assigned
+     *        instead of calling the update function or writing an output.
+     */
+    detail::slot_component< variable_binding, id_type > m_variables;
+
+    /** \brief The output of each slot, as assigned by bind_output(). */
+    detail::slot_component< output_binding, id_type > m_outputs;
+
+    /**
+     * \brief The values of the slots bound to the buffer owned by the system,
+     *        indexed by slot, up to the largest index bound to it.
+     */
+    std::vector< float_type > m_output_values;
+
+    /** \brief The components registered with register_component(). */
+    detail::user_components< id_type > m_user_components;
+
     ///@}
 
+    /**
+     * \brief The commands submitted with command_buffer_base, to be applied at
+     *        the beginning of the next update. It also allocates the
+     *        identifiers of the new slots.
+     */
+    detail::command_queue< Config > m_commands;
+
     /** \brief Slots that will be updated in the next update. */
     std::vector< id_type > m_need_update;
+
+    /**
+     * \name Progression of the updated slots
+     *
+     * The values computed by compute_update_ratios() for the slots of
+     * m_need_update, from the first slot updated by update_running_slots().
+     */
+    ///@{
+
+    /**
+     * \brief The dates and the end dates of the slots, copied in update order
+     *        such that the progression is computed from contiguous arrays.
+     */
+    std::vector< duration_type > m_update_dates;
+    std::vector< duration_type > m_update_end_dates;
+
+    /** \brief The ratio of the duration of each slot, before the transform. */
+    std::vector< float_type > m_update_ratios;
+
+    /**
+     * \brief Non-zero for the slots reaching their end in this update. After
+     *        the calls to the functions of the slots, only the slots actually
+     *        completed keep a non-zero value.
+     */
+    std::vector< std::uint8_t > m_update_completed;
+
+    ///@}
+
+    /**
+     * \brief The buffers passed to add_output_buffer(). The first entry is
+     *        the buffer owned by the system, storing its values in
+     *        m_output_values.
+     */
+    std::vector< output_storage > m_output_buffers;
+
+    /**
+     * \brief Where the copies of m_output_values are published at the end of
+     *        each update, if not null.
+     */
+    output_snapshots* m_output_snapshots;
+
+    /** \brief The groups created with register_update_group(). */
+    std::vector< group_storage > m_update_groups;
+
+    /**
+     * \brief The slots having a given tag, in no particular order.
+     *
+     * The entries are removed with the slots in remove_dead_slots(), and the
+     * tags without slots are erased.
+     */
+    std::unordered_map< tag_type, std::vector< id_type > > m_tagged_slots;
+
+    /**
+     * \brief The last slot bound to a given target with bind_target(), if it
+     *        has not completed yet.
+     */
+    std::unordered_map< const void*, id_type > m_slot_from_target;
+
+    /**
+     * \brief Incremented when slots are released or sequenced, or when the
+     *        system is loaded, such that restore_timing() can reject the
+     *        snapshots whose slots do not exist anymore.
+     *
+     * \sa change_structure.
+     */
+    std::uint64_t m_structure_version;
+
+    /** \brief The number of slots configured in the system. */
+    std::uint64_t m_created_count;
+
+    /**
+     * \brief The structure version and the count of created slots of the
+     *        snapshot restored since the last change of the structure, if
+     *        any, otherwise the current values.
+     *
+     * The restoration releases the slots created since the snapshot, thus it
+     * changes the structure, but the snapshot and the previous ones with the
+     * same version remain valid.
+     */
+    std::uint64_t m_restored_version;
+    std::uint64_t m_restored_created_count;
+  };
+
+  /**
+   * \brief The state of the progression of the slots of a system, as saved by
+   *        system_base::save_timing().
+   *
+   * The snapshot is meant to be reused: saving in a snapshot reuses its
+   * storage, thus saving the same system again and again costs no allocation
+   * and is about as fast as a memcpy of the state.
+   */
+  template< typename Config >
+  class system_base< Config >::timing_snapshot
+  {
+    friend class system_base< Config >;
+
+  public:
+    timing_snapshot();
+
+  private:
+    slot_state saved_state( std::size_t slot_id ) const;
+
+    template< typename T >
+    static char* write( char* out, const T* values, std::size_t count );
+
+    template< typename T >
+    static const char* read( const char* in, T* values, std::size_t count );
+
+  private:
+    /** \brief The system from which the snapshot was taken. */
+    const system_base* m_system;
+
+    /** \brief The value of m_structure_version when saved. */
+    std::uint64_t m_structure_version;
+
+    /** \brief The value of m_created_count when saved. */
+    std::uint64_t m_created_count;
+
+    /** \brief The number of slots in the system when saved. */
+    std::size_t m_slot_count;
+
+    /**
+     * \brief The sizes of m_start_queue, m_done_queue, m_dead_queue,
+     *        m_sequence_queue and m_need_update.
+     */
+    std::size_t m_queue_sizes[ 5 ];
+
+    /**
+     * \brief The states, the pause flags and the dates of the slots, followed
+     *        by the queues, one after the other.
+     */
+    std::vector< char > m_data;
   };
 
   using system = system_base<>;
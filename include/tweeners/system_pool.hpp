@@ -0,0 +1,138 @@
+#ifndef TWEENERS_SYSTEM_POOL_HPP
+#define TWEENERS_SYSTEM_POOL_HPP
+
+#include <tweeners/config.hpp>
+#include <tweeners/system.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tweeners
+{
+  /**
+   * \brief Update many independent tweeners::system in parallel.
+   *
+   * The pool owns a set of worker threads and a set of systems, either owned
+   * by the pool or borrowed from the client code. A call to update() updates
+   * all the systems, each system being updated by a single thread.
+   *
+   * The systems are dispatched to the threads according to their number of
+   * running slots, the biggest systems first, and a thread running out of
+   * work steals the remaining systems of the others. The duration of the last
+   * update of each system is available via update_cost().
+   *
+   * The callbacks of the tweeners are executed in the worker threads. Since a
+   * system is updated by a single thread at once, the callbacks of the
+   * tweeners of the same system are never executed concurrently, but the
+   * callbacks of different systems may be.
+   */
+  template< typename Config = config<> >
+  class system_pool_base
+  {
+  public:
+    using system_type = system_base< Config >;
+    using duration_type = typename Config::duration_type;
+
+  public:
+    explicit system_pool_base( std::size_t thread_count );
+    ~system_pool_base();
+
+    system_pool_base( const system_pool_base& ) = delete;
+    system_pool_base& operator=( const system_pool_base& ) = delete;
+
+    std::size_t thread_count() const;
+
+    std::size_t emplace();
+    std::size_t add( system_type& system );
+    void remove( std::size_t index );
+
+    system_type& get( std::size_t index );
+    std::size_t size() const;
+
+    void update( duration_type step );
+
+    std::chrono::nanoseconds update_cost( std::size_t index ) const;
+
+  private:
+    struct entry
+    {
+      /** \brief The system, nullptr if the entry is not used. */
+      system_type* system;
+
+      /** \brief The system if it is owned by the pool. */
+      std::unique_ptr< system_type > owned;
+
+      /** \brief The duration of the last update of the system. */
+      std::chrono::nanoseconds cost;
+    };
+
+    /** \brief The systems to be updated by a given thread. */
+    struct worker_queue
+    {
+      std::mutex mutex;
+      std::deque< std::size_t > systems;
+    };
+
+  private:
+    std::size_t insert( system_type* system );
+
+    void dispatch();
+    void work( std::size_t worker_index );
+    bool pop( std::size_t worker_index, std::size_t& system_index );
+    void run( std::size_t system_index );
+
+    void worker_loop( std::size_t worker_index );
+
+  private:
+    /** \brief The systems, indexed by the value returned by add(). */
+    std::vector< entry > m_entries;
+
+    /** \brief The indices in m_entries that are not used. */
+    std::vector< std::size_t > m_available_entries;
+
+    /**
+     * \brief The systems remaining to update by each worker. The entry zero
+     *        is for the thread calling update().
+     */
+    std::vector< std::unique_ptr< worker_queue > > m_queues;
+
+    /** \brief The time step of the current update. */
+    duration_type m_step;
+
+    /** \brief The number of systems not updated yet in the current update. */
+    std::atomic< std::size_t > m_pending;
+
+    /** \brief The first error thrown during the current update. */
+    std::exception_ptr m_error;
+
+    /** \brief Protects m_generation, m_stop and m_error. */
+    std::mutex m_mutex;
+
+    /** \brief Notified when an update begins. */
+    std::condition_variable m_wake_up;
+
+    /** \brief Notified when all the systems are updated. */
+    std::condition_variable m_done;
+
+    /** \brief Incremented at each update to wake up the workers. */
+    std::size_t m_generation;
+
+    /** \brief Tells the workers to stop. */
+    bool m_stop;
+
+    std::vector< std::thread > m_threads;
+  };
+
+  using system_pool = system_pool_base<>;
+}
+
+#include <tweeners/detail/system_pool.tpp>
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef TWEENERS_TRIPLE_BUFFER_HPP
+#define TWEENERS_TRIPLE_BUFFER_HPP
+
+#include <atomic>
+
+namespace tweeners
+{
+  /**
+   * \brief Pass complete values from one writer thread to one reader thread,
+   *        without locking.
+   *
+   * The writer fills write_buffer() then calls publish(). The reader calls
+   * acquire_latest() to get the last published value. Since there are three
+   * buffers, one for each side plus one in transit, the writer never waits
+   * for the reader and the reader never sees a value being written. Both
+   * sides are wait-free.
+   *
+   * Values published while the reader does not call acquire_latest() are
+   * overwritten by the next ones: the reader gets only the latest.
+   */
+  template< typename T >
+  class triple_buffer
+  {
+  public:
+    triple_buffer();
+    explicit triple_buffer( const T& initial_value );
+
+    triple_buffer( const triple_buffer& ) = delete;
+    triple_buffer& operator=( const triple_buffer& ) = delete;
+
+    T& write_buffer();
+    void publish();
+
+    const T& acquire_latest();
+
+  private:
+    /**
+     * \brief Set in m_middle when its buffer has been published and not
+     *        acquired yet.
+     */
+    static constexpr unsigned fresh_bit = 4;
+
+    /** \brief The bits of the index of a buffer in m_middle. */
+    static constexpr unsigned index_mask = 3;
+
+  private:
+    T m_buffers[ 3 ];
+
+    /** \brief The buffer filled by the writer. */
+    unsigned m_back;
+
+    /** \brief The buffer in transit, plus fresh_bit. */
+    std::atomic< unsigned > m_middle;
+
+    /** \brief The buffer read by the reader. */
+    unsigned m_front;
+  };
+}
+
+#include <tweeners/detail/triple_buffer.tpp>
+
+#endif
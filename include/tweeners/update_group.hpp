@@ -0,0 +1,45 @@
+#ifndef TWEENERS_UPDATE_GROUP_HPP
+#define TWEENERS_UPDATE_GROUP_HPP
+
+#include <cstddef>
+
+namespace tweeners
+{
+  template< typename Config >
+  class system_base;
+
+  /**
+   * \brief Handle to a callback receiving the values of many slots of a
+   *        tweeners::system at once.
+   *
+   * The handles are returned by system_base::register_update_group(). The
+   * handle is valid only for the system that created it.
+   *
+   * \sa system_base::bind_group.
+   */
+  class update_group
+  {
+    template< typename Config >
+    friend class system_base;
+
+  public:
+    update_group()
+      : m_index( -1 )
+    {
+
+    }
+
+  private:
+    explicit update_group( std::size_t index )
+      : m_index( index )
+    {
+
+    }
+
+  private:
+    /** \brief The index of the group in the system's storage. */
+    std::size_t m_index;
+  };
+}
+
+#endif
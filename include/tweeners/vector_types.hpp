@@ -0,0 +1,59 @@
+#ifndef TWEENERS_VECTOR_TYPES_HPP
+#define TWEENERS_VECTOR_TYPES_HPP
+
+#include <cstdint>
+
+namespace tweeners
+{
+  /**
+   * \name Multi-component values
+   *
+   * Values made of many components, like positions or colors, animated by a
+   * single slot. When they are the target of builder_base::range_transform(),
+   * the transform is evaluated once per update and all the components are
+   * interpolated together, then the whole value is assigned to the target at
+   * once.
+   */
+  ///@{
+
+  template< typename Float = float >
+  struct vec2
+  {
+    Float x;
+    Float y;
+  };
+
+  template< typename Float = float >
+  struct vec3
+  {
+    Float x;
+    Float y;
+    Float z;
+  };
+
+  template< typename Float = float >
+  struct vec4
+  {
+    Float x;
+    Float y;
+    Float z;
+    Float w;
+  };
+
+  /**
+   * \brief A color with eight bits per channel. The interpolated channels are
+   *        rounded to the nearest integer and clamped in [0, 255], thus the
+   *        easings going past their bounds saturate the color.
+   */
+  struct rgba8
+  {
+    std::uint8_t r;
+    std::uint8_t g;
+    std::uint8_t b;
+    std::uint8_t a;
+  };
+
+  ///@}
+}
+
+#endif
@@ -0,0 +1,158 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST( array_transform, shared_bounds )
+{
+  tweeners::system system;
+  std::vector< float > values( 1000, -1 );
+  int start_count( 0 );
+  int done_count( 0 );
+
+  tweeners::builder()
+    .array_transform
+    ( 0, 100, 10,
+      tweeners::span< float >( values.data(), values.size() ),
+      &tweeners::easing::linear< float > )
+    .on_start( [ &start_count ]() -> void { ++start_count; } )
+    .on_done( [ &done_count ]() -> void { ++done_count; } )
+    .build( system );
+
+  system.update( 4 );
+  EXPECT_EQ( 1, system.running_count() );
+
+  for ( float value : values )
+    EXPECT_FLOAT_EQ( 40, value );
+
+  system.update( 6 );
+
+  for ( float value : values )
+    EXPECT_FLOAT_EQ( 100, value );
+
+  EXPECT_EQ( 1, start_count );
+  EXPECT_EQ( 1, done_count );
+}
+
+TEST( array_transform, bounds_per_value )
+{
+  tweeners::system system;
+  constexpr std::size_t count( 37 );
+  std::vector< float > from( count );
+  std::vector< float > to( count );
+  std::vector< float > values( count, -1 );
+
+  for ( std::size_t i( 0 ); i != count; ++i )
+    {
+      from[ i ] = i;
+      to[ i ] = 2 * i + 10;
+    }
+
+  tweeners::builder()
+    .array_transform
+    ( tweeners::span< const float >( from.data(), count ),
+      tweeners::span< const float >( to.data(), count ), 10,
+      tweeners::span< float >( values.data(), count ),
+      &tweeners::easing::quad< float > )
+    .build( system );
+
+  system.update( 5 );
+
+  for ( std::size_t i( 0 ); i != count; ++i )
+    EXPECT_FLOAT_EQ( from[ i ] + 0.25 * ( to[ i ] - from[ i ] ), values[ i ] )
+      << "i=" << i;
+
+  system.update( 5 );
+
+  for ( std::size_t i( 0 ); i != count; ++i )
+    EXPECT_FLOAT_EQ( to[ i ], values[ i ] ) << "i=" << i;
+}
+
+TEST( array_transform, strided_target )
+{
+  struct particle
+  {
+    float x;
+    float y;
+    float alpha;
+  };
+
+  tweeners::system system;
+  std::vector< particle > particles( 10, particle{ 1, 2, 3 } );
+  std::vector< float > from( particles.size() );
+  std::vector< float > to( particles.size() );
+
+  for ( std::size_t i( 0 ); i != particles.size(); ++i )
+    {
+      from[ i ] = 0;
+      to[ i ] = i;
+    }
+
+  tweeners::builder()
+    .array_transform
+    ( tweeners::span< const float >( from.data(), from.size() ),
+      tweeners::span< const float >( to.data(), to.size() ), 10,
+      tweeners::strided_span< float >
+      ( &particles[ 0 ].y, particles.size(), 3 ),
+      &tweeners::easing::linear< float > )
+    .build( system );
+
+  tweeners::builder()
+    .array_transform
+    ( 1, 0, 10,
+      tweeners::strided_span< float >
+      ( &particles[ 0 ].alpha, particles.size(), 3 ),
+      &tweeners::easing::linear< float > )
+    .build( system );
+
+  system.update( 5 );
+
+  for ( std::size_t i( 0 ); i != particles.size(); ++i )
+    {
+      EXPECT_EQ( 1, particles[ i ].x ) << "i=" << i;
+      EXPECT_FLOAT_EQ( 0.5 * i, particles[ i ].y ) << "i=" << i;
+      EXPECT_FLOAT_EQ( 0.5, particles[ i ].alpha ) << "i=" << i;
+    }
+}
+
+TEST( array_transform, overwrite )
+{
+  tweeners::system system;
+  std::vector< float > values( 4, -1 );
+  const tweeners::span< float > target( values.data(), values.size() );
+
+  tweeners::builder()
+    .array_transform( 0, 10, 10, target, &tweeners::easing::linear< float > )
+    .overwrite( tweeners::overwrite_policy::keep_both )
+    .build( system );
+  system.update( 1 );
+
+  tweeners::builder()
+    .array_transform( 50, 60, 10, target, &tweeners::easing::linear< float > )
+    .overwrite( tweeners::overwrite_policy::replace_existing )
+    .build( system );
+  system.update( 1 );
+
+  EXPECT_EQ( 1, system.running_count() );
+
+  for ( float value : values )
+    EXPECT_FLOAT_EQ( 51, value );
+}
+
+TEST( array_transform, size_mismatch )
+{
+  std::vector< float > bounds( 3 );
+  std::vector< float > values( 4 );
+
+  EXPECT_THROW
+    ( tweeners::builder().array_transform
+      ( tweeners::span< const float >( bounds.data(), bounds.size() ),
+        tweeners::span< const float >( bounds.data(), bounds.size() ), 10,
+        tweeners::span< float >( values.data(), values.size() ),
+        &tweeners::easing::linear< float > ),
+      std::runtime_error );
+}
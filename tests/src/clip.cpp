@@ -0,0 +1,179 @@
+#include "tweeners/clip.hpp"
+#include "tweeners/clip_writer.hpp"
+#include "tweeners/system.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  /**
+   * Two parameters: the first one goes from 0 to 10 then back to 0, the second
+   * one goes from 0 to 1 with the first move.
+   */
+  tweeners::clip_writer two_parameters_clip()
+  {
+    tweeners::clip_writer result;
+
+    const std::uint32_t first
+      ( result.add_node( 10, tweeners::easing_id::linear, 0, 0, 10 ) );
+    result.add_node( 10, tweeners::easing_id::linear, 0, 10, 0, first );
+    result.add_node( 10, tweeners::easing_id::quad_out, 1, 0, 1 );
+
+    return result;
+  }
+
+  std::vector< std::uint32_t > clip_in_memory
+  ( const tweeners::clip_writer& writer )
+  {
+    std::ostringstream stream;
+    writer.write( stream );
+
+    const std::string data( stream.str() );
+    std::vector< std::uint32_t > result
+      ( ( data.size() + sizeof( std::uint32_t ) - 1 )
+        / sizeof( std::uint32_t ) );
+    std::memcpy( result.data(), data.data(), data.size() );
+
+    return result;
+  }
+}
+
+TEST( clip, instantiate )
+{
+  const std::vector< std::uint32_t > data
+    ( clip_in_memory( two_parameters_clip() ) );
+  const tweeners::clip clip
+    ( data.data(), data.size() * sizeof( std::uint32_t ) );
+
+  EXPECT_EQ( 3, clip.nodes().size() );
+  EXPECT_EQ( 2, clip.parameter_count() );
+
+  tweeners::system system;
+  float values[ 4 ] = { -1, -1, -1, -1 };
+  const tweeners::output_buffer buffer( system.add_output_buffer( values, 4 ) );
+
+  const std::size_t first_entries[] = { 0, 1 };
+  const std::size_t second_entries[] = { 2, 3 };
+
+  const std::vector< tweeners::system::id_type > first_slots
+    ( system.instantiate
+      ( clip,
+        tweeners::clip_bindings
+        { buffer, tweeners::span< const std::size_t >( first_entries, 2 ) } ) );
+  EXPECT_EQ( 3, first_slots.size() );
+
+  system.update( 5 );
+  EXPECT_FLOAT_EQ( 5, values[ 0 ] );
+  EXPECT_FLOAT_EQ( 0.75, values[ 1 ] );
+  EXPECT_FLOAT_EQ( -1, values[ 2 ] );
+
+  system.instantiate
+    ( clip,
+      tweeners::clip_bindings
+      { buffer, tweeners::span< const std::size_t >( second_entries, 2 ) } );
+
+  system.update( 10 );
+  EXPECT_FLOAT_EQ( 5, values[ 0 ] );
+  EXPECT_FLOAT_EQ( 1, values[ 1 ] );
+  EXPECT_FLOAT_EQ( 10, values[ 2 ] );
+  EXPECT_FLOAT_EQ( 1, values[ 3 ] );
+
+  system.update( 10 );
+  EXPECT_FLOAT_EQ( 0, values[ 0 ] );
+  EXPECT_FLOAT_EQ( 0, values[ 2 ] );
+}
+
+TEST( clip, chrono_duration )
+{
+  using chrono_config = tweeners::config< std::chrono::milliseconds >;
+
+  const std::vector< std::uint32_t > data
+    ( clip_in_memory( two_parameters_clip() ) );
+  const tweeners::clip clip
+    ( data.data(), data.size() * sizeof( std::uint32_t ) );
+
+  // The durations of the nodes are numbers of milliseconds.
+  tweeners::system_base< chrono_config > system;
+  float values[ 2 ] = { -1, -1 };
+  const tweeners::output_buffer buffer( system.add_output_buffer( values, 2 ) );
+  const std::size_t entries[] = { 0, 1 };
+
+  system.instantiate
+    ( clip,
+      tweeners::clip_bindings
+      { buffer, tweeners::span< const std::size_t >( entries, 2 ) } );
+
+  system.update( std::chrono::milliseconds( 5 ) );
+  EXPECT_FLOAT_EQ( 5, values[ 0 ] );
+  EXPECT_FLOAT_EQ( 0.75, values[ 1 ] );
+
+  system.update( std::chrono::milliseconds( 10 ) );
+  EXPECT_FLOAT_EQ( 5, values[ 0 ] );
+  EXPECT_FLOAT_EQ( 1, values[ 1 ] );
+}
+
+TEST( clip, file )
+{
+  const std::string path( testing::TempDir() + "tweeners-test.twcl" );
+  two_parameters_clip().save( path );
+
+  {
+    const tweeners::clip clip( path );
+    ASSERT_EQ( 3, clip.nodes().size() );
+    EXPECT_EQ( 0, clip.nodes()[ 1 ].parameter );
+    EXPECT_EQ( 0, clip.nodes()[ 1 ].predecessor );
+    EXPECT_FLOAT_EQ( 10, clip.nodes()[ 1 ].from );
+  }
+
+  std::remove( path.c_str() );
+
+  EXPECT_THROW( tweeners::clip clip( path ), std::runtime_error );
+}
+
+TEST( clip, invalid_data )
+{
+  std::vector< std::uint32_t > data( clip_in_memory( two_parameters_clip() ) );
+  const std::size_t size( data.size() * sizeof( std::uint32_t ) );
+
+  EXPECT_THROW
+    ( tweeners::clip( data.data(), size - 1 ), std::runtime_error );
+
+  // The predecessor of the second node is set to itself.
+  tweeners::clip_node* const nodes
+    ( reinterpret_cast< tweeners::clip_node* >
+      ( reinterpret_cast< char* >( data.data() )
+        + sizeof( tweeners::detail::clip_header ) ) );
+  nodes[ 1 ].predecessor = 1;
+
+  EXPECT_THROW( tweeners::clip( data.data(), size ), std::runtime_error );
+
+  data[ 0 ] = 0;
+  EXPECT_THROW( tweeners::clip( data.data(), size ), std::runtime_error );
+}
+
+TEST( clip, missing_binding )
+{
+  const std::vector< std::uint32_t > data
+    ( clip_in_memory( two_parameters_clip() ) );
+  const tweeners::clip clip
+    ( data.data(), data.size() * sizeof( std::uint32_t ) );
+
+  tweeners::system system;
+  float values[ 1 ];
+  const std::size_t entries[] = { 0 };
+
+  EXPECT_THROW
+    ( system.instantiate
+      ( clip,
+        tweeners::clip_bindings
+        { system.add_output_buffer( values, 1 ),
+          tweeners::span< const std::size_t >( entries, 1 ) } ),
+      std::runtime_error );
+}
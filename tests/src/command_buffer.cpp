@@ -0,0 +1,262 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/command_buffer.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST( command_buffer, applied_at_update )
+{
+  int value( -1 );
+  bool started( false );
+  bool done( false );
+
+  tweeners::system system;
+  tweeners::command_buffer commands( system );
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .on_start( [ &started ]() -> void { started = true; } )
+      .on_done( [ &done ]() -> void { done = true; } )
+      .build( commands ) );
+
+  commands.submit();
+  EXPECT_EQ( -1, value );
+  EXPECT_FALSE( started );
+
+  system.update( 4 );
+  EXPECT_EQ( 40, value );
+  EXPECT_TRUE( started );
+
+  system.update( 6 );
+  EXPECT_EQ( 100, value );
+  EXPECT_TRUE( done );
+
+  commands.remove_slot( slot );
+  commands.submit();
+  system.update( 1 );
+
+  // The removed id is recycled.
+  EXPECT_EQ
+    ( slot,
+      system.configure_slot
+      ( 1, []( float ) -> void {}, &tweeners::easing::linear< float > ) );
+}
+
+TEST( command_buffer, sequence )
+{
+  int value_1( -1 );
+  int value_2( -1 );
+
+  tweeners::system system;
+
+  {
+    tweeners::command_buffer commands( system );
+
+    const tweeners::system::id_type first
+      ( tweeners::builder()
+        .range_transform
+        ( 0, 100, 10, value_1, &tweeners::easing::linear< float > )
+        .build( commands ) );
+
+    tweeners::builder()
+      .range_transform
+      ( 0, 100, 10, value_2, &tweeners::easing::linear< float > )
+      .after( first )
+      .build( commands );
+
+    // The commands are submitted when the buffer is destroyed.
+  }
+
+  system.update( 15 );
+  EXPECT_EQ( 100, value_1 );
+  EXPECT_EQ( 50, value_2 );
+}
+
+TEST( command_buffer, interleaved_with_system )
+{
+  int value_1( -1 );
+  int value_2( -1 );
+
+  tweeners::system system;
+  tweeners::command_buffer commands( system );
+
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value_1, &tweeners::easing::linear< float > )
+    .build( commands );
+
+  // This slot is created before the one of the command buffer, with a greater
+  // identifier.
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value_2, &tweeners::easing::linear< float > )
+    .build( system );
+
+  commands.submit();
+  system.update( 2 );
+
+  EXPECT_EQ( 20, value_1 );
+  EXPECT_EQ( 20, value_2 );
+}
+
+TEST( command_buffer, recycled_batches )
+{
+  tweeners::system system;
+  tweeners::command_buffer commands( system );
+  std::vector< int > started;
+
+  for ( int i( 0 ); i != 3; ++i )
+    {
+      // The batch applied in the previous iteration is reused here, with
+      // fewer arguments.
+      const int count( 3 - i );
+
+      for ( int j( 0 ); j != count; ++j )
+        tweeners::builder()
+          .range_transform
+          ( 0, 1, 10, []( float ) -> void {},
+            &tweeners::easing::linear< float > )
+          .on_start( [ &started, i ]() -> void { started.push_back( i ); } )
+          .build( commands );
+
+      commands.submit();
+      started.clear();
+      system.update( 1 );
+
+      EXPECT_EQ( std::vector< int >( count, i ), started );
+    }
+}
+
+TEST( command_buffer, recycled_ids )
+{
+  tweeners::system system;
+  tweeners::command_buffer commands( system );
+  tweeners::system::id_type largest_id( 0 );
+
+  for ( int i( 0 ); i != 20; ++i )
+    {
+      const tweeners::system::id_type slot
+        ( commands.configure_slot
+          ( 1, []( float ) -> void {}, &tweeners::easing::linear< float > ) );
+      commands.start_slot( slot );
+      commands.submit();
+
+      largest_id = std::max( largest_id, slot );
+
+      system.update( 1 );
+      commands.remove_slot( slot );
+    }
+
+  // The identifiers of the removed slots are given back to the buffer.
+  EXPECT_GE( 2, largest_id );
+}
+
+TEST( command_buffer, invalid_command )
+{
+  tweeners::system system;
+  tweeners::command_buffer commands( system );
+
+  commands.start_slot( 12 );
+  commands.submit();
+
+  EXPECT_THROW( system.update( 1 ), std::runtime_error );
+  EXPECT_NO_THROW( system.update( 1 ) );
+}
+
+TEST( command_buffer, failed_command )
+{
+  int value_1( -1 );
+  int value_2( -1 );
+
+  tweeners::system system;
+  tweeners::command_buffer commands( system );
+
+  // The sequence fails, thus the second slot is configured but can't start.
+  const tweeners::system::id_type failed
+    ( tweeners::builder()
+      .range_transform
+      ( 0, 100, 10, value_1, &tweeners::easing::linear< float > )
+      .after( 12 )
+      .build( commands ) );
+  commands.submit();
+
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value_2, &tweeners::easing::linear< float > )
+    .build( commands );
+  commands.submit();
+
+  EXPECT_THROW( system.update( 1 ), std::runtime_error );
+
+  // The commands following the failure are applied.
+  system.update( 1 );
+  EXPECT_EQ( -1, value_1 );
+  EXPECT_EQ( 10, value_2 );
+  EXPECT_EQ( 1u, system.running_count() );
+
+  // The failed slot has been removed and its identifier is recycled.
+  EXPECT_EQ
+    ( failed,
+      system.configure_slot
+      ( 1, []( float ) -> void {}, &tweeners::easing::linear< float > ) );
+}
+
+TEST( command_buffer, concurrent )
+{
+  constexpr int thread_count( 4 );
+  constexpr int slots_per_thread( 100 );
+
+  tweeners::system system;
+  std::atomic< int > start_count( 0 );
+  std::vector< std::vector< tweeners::system::id_type > > slots
+    ( thread_count );
+  std::vector< std::thread > threads;
+
+  for ( int i( 0 ); i != thread_count; ++i )
+    threads.emplace_back
+      ( [ &system, &start_count, &slots, i ]() -> void
+        {
+          tweeners::command_buffer commands( system );
+
+          for ( int j( 0 ); j != slots_per_thread; ++j )
+            {
+              slots[ i ].push_back
+                ( tweeners::builder()
+                  .range_transform
+                  ( 0, 1, 10, []( float ) -> void {},
+                    &tweeners::easing::linear< float > )
+                  .on_start
+                  ( [ &start_count ]() -> void { ++start_count; } )
+                  .build( commands ) );
+
+              if ( j % 10 == 0 )
+                commands.submit();
+            }
+        } );
+
+  // Updating while the commands are submitted must be safe.
+  for ( int i( 0 ); i != 10; ++i )
+    system.update( 0 );
+
+  for ( std::thread& t : threads )
+    t.join();
+
+  system.update( 1 );
+
+  EXPECT_EQ( thread_count * slots_per_thread, start_count );
+
+  std::vector< tweeners::system::id_type > all_slots;
+
+  for ( const std::vector< tweeners::system::id_type >& s : slots )
+    all_slots.insert( all_slots.end(), s.begin(), s.end() );
+
+  std::sort( all_slots.begin(), all_slots.end() );
+
+  EXPECT_TRUE
+    ( std::adjacent_find( all_slots.begin(), all_slots.end() )
+      == all_slots.end() );
+}
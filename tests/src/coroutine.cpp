@@ -0,0 +1,253 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/coroutine.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  /**
+   * A coroutine starting immediately, whose frame is destroyed with the task.
+   */
+  class task
+  {
+  public:
+    struct promise_type
+    {
+      task get_return_object()
+      {
+        return task
+          ( std::coroutine_handle< promise_type >::from_promise( *this ) );
+      }
+
+      std::suspend_never initial_suspend() noexcept { return {}; }
+      std::suspend_always final_suspend() noexcept { return {}; }
+      void return_void() {}
+      void unhandled_exception() { std::terminate(); }
+    };
+
+  public:
+    explicit task( std::coroutine_handle< promise_type > handle )
+      : m_handle( handle )
+    {}
+
+    task( task&& that )
+      : m_handle( that.m_handle )
+    {
+      that.m_handle = nullptr;
+    }
+
+    ~task()
+    {
+      if ( m_handle )
+        m_handle.destroy();
+    }
+
+    bool done() const
+    {
+      return m_handle.done();
+    }
+
+  private:
+    std::coroutine_handle< promise_type > m_handle;
+  };
+
+  tweeners::system::id_type start_tweener
+  ( tweeners::system& system, int& value, float duration )
+  {
+    return tweeners::builder()
+      .range_transform
+      ( 0, 100, duration, value, &tweeners::easing::linear< float > )
+      .build( system );
+  }
+}
+
+TEST( coroutine, sequence )
+{
+  tweeners::system system;
+  int value_1( -1 );
+  int value_2( -1 );
+  std::vector< bool > results;
+
+  auto script
+    ( [ & ]() -> task
+      {
+        results.push_back
+          ( co_await system.done( start_tweener( system, value_1, 10 ) ) );
+        results.push_back
+          ( co_await system.done( start_tweener( system, value_2, 10 ) ) );
+      } );
+
+  task t( script() );
+  EXPECT_FALSE( t.done() );
+
+  system.update( 5 );
+  EXPECT_EQ( 50, value_1 );
+  EXPECT_TRUE( results.empty() );
+
+  system.update( 5 );
+  EXPECT_EQ( 100, value_1 );
+  EXPECT_EQ( std::vector< bool >( { true } ), results );
+
+  // The second tweener is created during the update, thus it starts in the
+  // next one.
+  EXPECT_EQ( -1, value_2 );
+
+  system.update( 4 );
+  EXPECT_EQ( 40, value_2 );
+
+  system.update( 6 );
+  EXPECT_EQ( 100, value_2 );
+  EXPECT_EQ( std::vector< bool >( { true, true } ), results );
+  EXPECT_TRUE( t.done() );
+}
+
+TEST( coroutine, resumed_after_done_callback )
+{
+  tweeners::system system;
+  int value( -1 );
+  std::vector< int > order;
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .on_done( [ &order ]() -> void { order.push_back( 0 ); } )
+      .build( system ) );
+
+  auto wait
+    ( [ & ]( int id ) -> task
+      {
+        co_await system.done( slot );
+        order.push_back( id );
+      } );
+
+  task t1( wait( 1 ) );
+  task t2( wait( 2 ) );
+
+  system.update( 10 );
+  EXPECT_EQ( std::vector< int >( { 0, 1, 2 } ), order );
+  EXPECT_TRUE( t1.done() );
+  EXPECT_TRUE( t2.done() );
+}
+
+TEST( coroutine, removed )
+{
+  tweeners::system system;
+  int value( -1 );
+  std::vector< bool > results;
+
+  const tweeners::system::id_type slot( start_tweener( system, value, 10 ) );
+
+  auto wait
+    ( [ & ]() -> task
+      {
+        results.push_back( co_await system.done( slot ) );
+      } );
+
+  task t( wait() );
+
+  system.update( 5 );
+  system.remove_slot( slot );
+  EXPECT_TRUE( results.empty() );
+
+  system.update( 1 );
+  EXPECT_EQ( std::vector< bool >( { false } ), results );
+  EXPECT_TRUE( t.done() );
+}
+
+TEST( coroutine, destroyed_while_waiting )
+{
+  tweeners::system system;
+  int value( -1 );
+  bool resumed( false );
+
+  const tweeners::system::id_type slot( start_tweener( system, value, 10 ) );
+
+  auto wait
+    ( [ & ]() -> task
+      {
+        co_await system.done( slot );
+        resumed = true;
+      } );
+
+  task kept( wait() );
+
+  {
+    task destroyed( wait() );
+    system.update( 5 );
+  }
+
+  system.update( 5 );
+  EXPECT_TRUE( resumed );
+  EXPECT_TRUE( kept.done() );
+}
+
+TEST( coroutine, destroyed_by_done_callback )
+{
+  tweeners::system system;
+  int value( -1 );
+  std::vector< int > order;
+  std::optional< task > destroyed;
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .on_done( [ &destroyed ]() -> void { destroyed.reset(); } )
+      .build( system ) );
+
+  auto wait
+    ( [ & ]( int id ) -> task
+      {
+        co_await system.done( slot );
+        order.push_back( id );
+      } );
+
+  task first( wait( 1 ) );
+  destroyed.emplace( wait( 2 ) );
+  task last( wait( 3 ) );
+
+  system.update( 10 );
+  EXPECT_EQ( std::vector< int >( { 1, 3 } ), order );
+  EXPECT_TRUE( first.done() );
+  EXPECT_TRUE( last.done() );
+}
+
+TEST( coroutine, destroyed_by_resumed_coroutine )
+{
+  tweeners::system system;
+  int value( -1 );
+  std::vector< int > order;
+  std::optional< task > destroyed;
+
+  const tweeners::system::id_type slot( start_tweener( system, value, 10 ) );
+
+  auto wait
+    ( [ & ]( int id ) -> task
+      {
+        co_await system.done( slot );
+        order.push_back( id );
+        destroyed.reset();
+      } );
+
+  task first( wait( 1 ) );
+  destroyed.emplace( wait( 2 ) );
+
+  system.remove_slot( slot );
+  system.update( 1 );
+
+  EXPECT_EQ( std::vector< int >( { 1 } ), order );
+  EXPECT_TRUE( first.done() );
+}
+
+TEST( coroutine, invalid_slot )
+{
+  tweeners::system system;
+
+  EXPECT_THROW( system.done( 0 ), std::runtime_error );
+}
@@ -0,0 +1,107 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/cubic_bezier.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  /**
+   * Evaluate cubic-bezier( x1, y1, x2, y2 ) at t with a precise bisection on
+   * the parameter of the curve.
+   */
+  double reference_cubic_bezier
+  ( double x1, double y1, double x2, double y2, double t )
+  {
+    const auto coordinate
+      ( []( double p1, double p2, double u ) -> double
+        {
+          const double v( 1 - u );
+          return 3 * v * v * u * p1 + 3 * v * u * u * p2 + u * u * u;
+        } );
+
+    double low( 0 );
+    double high( 1 );
+
+    for ( int i( 0 ); i != 100; ++i )
+      {
+        const double middle( ( low + high ) / 2 );
+
+        if ( coordinate( x1, x2, middle ) < t )
+          low = middle;
+        else
+          high = middle;
+      }
+
+    return coordinate( y1, y2, ( low + high ) / 2 );
+  }
+}
+
+TEST( cubic_bezier, accuracy )
+{
+  const double curves[][ 4 ] =
+    {
+      { 0.25, 0.1, 0.25, 1 },
+      { 0.42, 0, 1, 1 },
+      { 0, 0, 0.58, 1 },
+      { 0.42, 0, 0.58, 1 },
+      { 0.68, -0.55, 0.265, 1.55 },
+      { 1, 0, 0, 1 }
+    };
+
+  for ( const auto& c : curves )
+    {
+      const tweeners::easing::cubic_bezier< double > curve
+        ( c[ 0 ], c[ 1 ], c[ 2 ], c[ 3 ] );
+
+      for ( int i( 0 ); i <= 1000; ++i )
+        {
+          const double t( i / 1000. );
+
+          EXPECT_NEAR
+            ( reference_cubic_bezier( c[ 0 ], c[ 1 ], c[ 2 ], c[ 3 ], t ),
+              curve( t ), 1e-4 )
+            << "t=" << t << " curve=" << c[ 0 ] << ',' << c[ 1 ] << ','
+            << c[ 2 ] << ',' << c[ 3 ];
+        }
+    }
+}
+
+TEST( cubic_bezier, bounds )
+{
+  const tweeners::easing::cubic_bezier<> curve( 0.25, 0.1, 0.25, 1 );
+
+  EXPECT_FLOAT_EQ( 0, curve( 0 ) );
+  EXPECT_FLOAT_EQ( 1, curve( 1 ) );
+
+  const tweeners::easing::cubic_bezier<> linear( 0, 0, 1, 1 );
+
+  for ( int i( 0 ); i <= 10; ++i )
+    EXPECT_NEAR( i / 10.f, linear( i / 10.f ), 1e-6 );
+}
+
+TEST( cubic_bezier, invalid_control_points )
+{
+  EXPECT_THROW
+    ( tweeners::easing::cubic_bezier<>( -0.1, 0, 1, 1 ), std::runtime_error );
+  EXPECT_THROW
+    ( tweeners::easing::cubic_bezier<>( 0, 0, 1.1, 1 ), std::runtime_error );
+}
+
+TEST( cubic_bezier, transform )
+{
+  tweeners::system system;
+  float value( 0 );
+
+  tweeners::builder()
+    .range_transform
+    ( 0.f, 100.f, 10, value, tweeners::easing::cubic_bezier<>( 0, 0, 1, 1 ) )
+    .build( system );
+
+  system.update( 5 );
+  EXPECT_NEAR( 50, value, 1e-3 );
+}
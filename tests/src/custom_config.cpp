@@ -3,6 +3,8 @@
 #include "tweeners/system.hpp"
 
 #include <chrono>
+#include <cstdint>
+#include <limits>
 #include <type_traits>
 
 #include <gtest/gtest.h>
@@ -69,3 +71,63 @@ TEST( system, custom_config )
   system.update( std::chrono::seconds( 3 ) );
   EXPECT_FLOAT_EQ( 40, value );
 }
+
+TEST( system, narrow_id )
+{
+  using narrow_config = tweeners::config< float, std::int16_t, double >;
+
+  static_assert
+    ( std::is_same
+      <
+        std::int16_t,
+        tweeners::system_base< narrow_config >::id_type
+      >::value,
+      "The id type from the configuration is not used." );
+  static_assert
+    ( std::is_same
+      <
+        double,
+        tweeners::system_base< narrow_config >::float_type
+      >::value,
+      "The float type from the configuration is not used." );
+
+  double value;
+
+  tweeners::system_base< narrow_config > system;
+
+  // The counts are not narrowed to the id type.
+  system.reserve( 40000, 40000, 40000 );
+
+  tweeners::builder_base< narrow_config >()
+    .range_transform( 0., 1., 4, value, &tweeners::easing::linear< double > )
+    .build( system );
+
+  system.update( 1 );
+  EXPECT_DOUBLE_EQ( 0.25, value );
+}
+
+TEST( system, id_overflow )
+{
+  using tiny_config = tweeners::config< float, std::int8_t >;
+
+  tweeners::system_base< tiny_config > system;
+  int slot_count( 0 );
+
+  auto create_slot
+    ( [ &system ]() -> void
+      {
+        system.configure_slot
+          ( 1, []( float ) -> void {}, &tweeners::easing::linear< float > );
+      } );
+
+  for ( ; slot_count != std::numeric_limits< std::int8_t >::max();
+        ++slot_count )
+    create_slot();
+
+  EXPECT_THROW( create_slot(), std::runtime_error );
+
+  system.remove_slot( 12 );
+  system.update( 1 );
+
+  EXPECT_NO_THROW( create_slot() );
+}
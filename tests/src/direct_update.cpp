@@ -0,0 +1,150 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/command_buffer.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/easing_functors.hpp"
+#include "tweeners/serialization.hpp"
+#include "tweeners/system.hpp"
+
+#include <sstream>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  struct fast_direct_update_config:
+    tweeners::config<>
+  {
+    using easing_precision = tweeners::easing::fast;
+  };
+}
+
+TEST( direct_update, builder )
+{
+  tweeners::system system;
+  float function_value( -1 );
+  float functor_value( -1 );
+  float lambda_value( -1 );
+
+  tweeners::builder()
+    .range_transform
+    ( 0.f, 10.f, 10, function_value, &tweeners::easing::quad< float > )
+    .build( system );
+  tweeners::builder()
+    .range_transform
+    ( 0.f, 10.f, 10, functor_value,
+      tweeners::easing::ease_out_t< tweeners::easing::quad_t >() )
+    .build( system );
+  tweeners::builder()
+    .range_transform
+    ( 0.f, 10.f, 10, lambda_value,
+      []( float t ) -> float { return t * t; } )
+    .build( system );
+
+  system.update( 5 );
+  EXPECT_FLOAT_EQ( 2.5, function_value );
+  EXPECT_FLOAT_EQ( 7.5, functor_value );
+  EXPECT_FLOAT_EQ( 2.5, lambda_value );
+
+  system.update( 5 );
+  EXPECT_FLOAT_EQ( 10, function_value );
+  EXPECT_FLOAT_EQ( 10, functor_value );
+  EXPECT_FLOAT_EQ( 10, lambda_value );
+}
+
+TEST( direct_update, overwrite )
+{
+  tweeners::system system;
+  float value( -1 );
+
+  tweeners::builder()
+    .range_transform( 0.f, 10.f, 10, value, tweeners::easing::linear_t() )
+    .overwrite( tweeners::overwrite_policy::keep_both )
+    .build( system );
+
+  system.update( 5 );
+  EXPECT_FLOAT_EQ( 5, value );
+
+  tweeners::builder()
+    .range_transform( 20.f, 30.f, 10, value, tweeners::easing::linear_t() )
+    .overwrite( tweeners::overwrite_policy::replace_existing )
+    .build( system );
+
+  system.update( 5 );
+  EXPECT_FLOAT_EQ( 25, value );
+}
+
+TEST( direct_update, command_buffer )
+{
+  tweeners::system system;
+  tweeners::command_buffer commands( system );
+  float value( -1 );
+
+  tweeners::builder()
+    .range_transform( 0.f, 10.f, 10, value, tweeners::easing::quad_t() )
+    .build( commands );
+  commands.submit();
+
+  system.update( 5 );
+  EXPECT_FLOAT_EQ( 2.5, value );
+}
+
+TEST( direct_update, configure_slot )
+{
+  tweeners::system_base< fast_direct_update_config > system;
+  float value( -1 );
+
+  const tweeners::system::id_type slot
+    ( system.configure_slot
+      ( 10, nullptr, tweeners::easing_id::elastic_out ) );
+  system.bind_variable( slot, 0, 1, value );
+  system.start_slot( slot );
+
+  system.update( 5 );
+  EXPECT_EQ
+    ( ( tweeners::easing::out
+        < float, &tweeners::easing::fast_elastic< float > >( 0.5f ) ),
+      value );
+}
+
+TEST( direct_update, builder_with_precision )
+{
+  tweeners::system_base< fast_direct_update_config > system;
+  float value( -1 );
+
+  // The pointer to the precise function is recognized as the sine easing,
+  // then evaluated with the approximation of the configuration.
+  tweeners::builder_base< fast_direct_update_config >()
+    .range_transform
+    ( 0.f, 1.f, 10, value, &tweeners::easing::sine< float > )
+    .build( system );
+
+  system.update( 3 );
+  EXPECT_EQ( tweeners::easing::fast_sine( 0.3f ), value );
+}
+
+TEST( direct_update, save )
+{
+  tweeners::system system;
+  float value( -1 );
+  std::ostringstream stream;
+
+  tweeners::builder()
+    .range_transform( 0.f, 10.f, 10, value, tweeners::easing::linear_t() )
+    .build( system );
+
+  EXPECT_THROW( tweeners::save_system( system, stream ), std::runtime_error );
+
+  tweeners::system named;
+
+  // With names, the variable is updated by a function which can be saved.
+  tweeners::builder()
+    .range_transform( 0.f, 10.f, 10, value, tweeners::easing::linear_t() )
+    .names( { "assign", "linear", "", "" } )
+    .build( named );
+
+  EXPECT_NO_THROW( tweeners::save_system( named, stream ) );
+
+  named.update( 5 );
+  EXPECT_FLOAT_EQ( 5, value );
+}
@@ -0,0 +1,140 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/easing_functors.hpp"
+#include "tweeners/system.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  template< typename Easing >
+  void expect_same_easing( tweeners::easing_id id )
+  {
+    static_assert
+      ( tweeners::easing::has_easing_id< Easing >::value,
+        "The easing should have an identifier." );
+    EXPECT_EQ( id, tweeners::easing::easing_id_of< Easing >::value );
+
+    float ( * const function )( float )( tweeners::easing::function( id ) );
+
+    for ( int i( 0 ); i <= 100; ++i )
+      {
+        const float t( i / 100.f );
+        EXPECT_EQ( function( t ), Easing()( t ) )
+          << tweeners::easing::name( id ) << " t=" << t;
+      }
+  }
+
+  template< typename Easing >
+  void expect_same_easing_variants( tweeners::easing_id id )
+  {
+    using namespace tweeners::easing;
+
+    expect_same_easing< Easing >( id );
+    expect_same_easing< ease_out_t< Easing > >
+      ( tweeners::easing_id( std::uint8_t( id ) + 1 ) );
+    expect_same_easing< ease_in_out_t< Easing > >
+      ( tweeners::easing_id( std::uint8_t( id ) + 2 ) );
+  }
+}
+
+TEST( easing_functors, built_in )
+{
+  using namespace tweeners::easing;
+
+  expect_same_easing< none_t >( tweeners::easing_id::none );
+  expect_same_easing< linear_t >( tweeners::easing_id::linear );
+  expect_same_easing_variants< sine_t >( tweeners::easing_id::sine );
+  expect_same_easing_variants< tweeners::easing::quad_t >
+    ( tweeners::easing_id::quad );
+  expect_same_easing_variants< cubic_t >( tweeners::easing_id::cubic );
+  expect_same_easing_variants< quart_t >( tweeners::easing_id::quart );
+  expect_same_easing_variants< quint_t >( tweeners::easing_id::quint );
+  expect_same_easing_variants< circ_t >( tweeners::easing_id::circ );
+  expect_same_easing_variants< expo_t >( tweeners::easing_id::expo );
+  expect_same_easing_variants< elastic_t >( tweeners::easing_id::elastic );
+  expect_same_easing_variants< bounce_t >( tweeners::easing_id::bounce );
+  expect_same_easing_variants< back_t >( tweeners::easing_id::back );
+}
+
+TEST( easing_functors, combinators )
+{
+  using namespace tweeners::easing;
+  using quad = tweeners::easing::quad_t;
+
+  static_assert( ease_out_t< quad >()( 0.5f ) == 0.75f, "" );
+  static_assert( mirror< linear_t >()( 0.25f ) == 0.5f, "" );
+  static_assert( mirror< linear_t >()( 0.75f ) == 0.5f, "" );
+  static_assert( mirror< linear_t >()( 1.f ) == 0, "" );
+  static_assert( chain< quad, quad >()( 0.5f ) == 0.0625f, "" );
+  static_assert
+    ( scale< linear_t, std::ratio< 1, 4 > >()( 0.5f ) == 0.125f, "" );
+  static_assert
+    ( blend< linear_t, quad, std::ratio< 1, 4 > >()( 0.5f )
+      == 0.75f * 0.5f + 0.25f * 0.25f,
+      "" );
+  static_assert( blend< none_t, linear_t >()( 1.f ) == 0.5f, "" );
+  static_assert( clamp< back_t >()( 0.1f ) == 0, "" );
+  static_assert( clamp< ease_out_t< back_t > >()( 0.9f ) == 1, "" );
+  static_assert( clamp< linear_t >()( 0.5f ) == 0.5f, "" );
+
+  EXPECT_FLOAT_EQ
+    ( 1 - std::cos( 0.25 * M_PI ), ( mirror< sine_t >()( 0.25 ) ) );
+}
+
+TEST( easing_functors, easing_id )
+{
+  using namespace tweeners::easing;
+
+  static_assert( !has_easing_id< mirror< sine_t > >::value, "" );
+  static_assert( !has_easing_id< ease_out_t< linear_t > >::value, "" );
+  static_assert
+    ( !has_easing_id< ease_out_t< ease_out_t< sine_t > > >::value, "" );
+  static_assert
+    ( !has_easing_id< ease_in_out_t< mirror< sine_t > > >::value, "" );
+  static_assert
+    ( easing_id_of< ease_in_out_t< bounce_t > >::value
+      == tweeners::easing_id::bounce_in_out,
+      "" );
+}
+
+TEST( easing_functors, transform )
+{
+  tweeners::system system;
+  float value( 0 );
+
+  tweeners::builder()
+    .range_transform
+    ( 0.f, 10.f, 10, value,
+      tweeners::easing::mirror< tweeners::easing::linear_t >() )
+    .build( system );
+
+  system.update( 5 );
+  EXPECT_FLOAT_EQ( 10, value );
+
+  system.update( 4 );
+  EXPECT_FLOAT_EQ( 2, value );
+}
+
+TEST( easing_functors, build_twice )
+{
+  tweeners::system system;
+  tweeners::builder builder;
+
+  // The easing identifier replaces the previous transform, thus nothing is
+  // left to build after the first call.
+  builder
+    .range_transform( 0.f, 10.f, 10, []( float t ) -> float { return t; } )
+    .range_transform( 0.f, 10.f, 10, tweeners::easing::sine_t() )
+    .build( system );
+  EXPECT_THROW( builder.build( system ), std::runtime_error );
+
+  builder
+    .range_transform( 0.f, 10.f, 10, []( float t ) -> float { return t; } )
+    .range_transform( 0.f, 10.f, 10, &tweeners::easing::sine< float > )
+    .build( system );
+  EXPECT_THROW( builder.build( system ), std::runtime_error );
+}
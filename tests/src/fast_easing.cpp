@@ -0,0 +1,176 @@
+#include "tweeners/clip.hpp"
+#include "tweeners/clip_writer.hpp"
+#include "tweeners/config.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  template< typename Float >
+  void expect_close_easing
+  ( Float ( *exact )( Float ), Float ( *approximation )( Float ),
+    Float tolerance )
+  {
+    for ( int i( 0 ); i <= 100000; ++i )
+      {
+        const Float t( Float( i ) / 100000 );
+        EXPECT_NEAR( exact( t ), approximation( t ), tolerance ) << "t=" << t;
+      }
+  }
+
+  struct fast_easing_config:
+    tweeners::config<>
+  {
+    using easing_precision = tweeners::easing::fast;
+  };
+}
+
+TEST( fast_easing, accuracy_float )
+{
+  using namespace tweeners::easing;
+
+  expect_close_easing< float >( &sine, &fast_sine, 5e-7 );
+  expect_close_easing< float >( &expo, &fast_expo, 5e-7 );
+  expect_close_easing< float >( &elastic, &fast_elastic, 2e-6 );
+
+  // circ() loses bits in 1 - t * t near 1, where fast_circ() does not.
+  expect_close_easing< float >( &circ, &fast_circ, 1e-6 );
+}
+
+TEST( fast_easing, accuracy_double )
+{
+  using namespace tweeners::easing;
+
+  expect_close_easing< double >( &sine, &fast_sine, 1e-12 );
+  expect_close_easing< double >( &circ, &fast_circ, 1e-13 );
+  expect_close_easing< double >( &expo, &fast_expo, 3e-10 );
+  expect_close_easing< double >( &elastic, &fast_elastic, 3e-10 );
+}
+
+TEST( fast_easing, bounds )
+{
+  using namespace tweeners::easing;
+
+  EXPECT_EQ( 0, fast_sine( 0.f ) );
+  EXPECT_FLOAT_EQ( 1, fast_sine( 1.f ) );
+  EXPECT_NEAR( 0, fast_circ( 0.f ), 1e-7 );
+  EXPECT_EQ( 1, fast_circ( 1.f ) );
+  EXPECT_EQ( 0, fast_expo( 0.f ) );
+  EXPECT_EQ( 1, fast_expo( 1.f ) );
+  EXPECT_FLOAT_EQ( 1, fast_elastic( 1.f ) );
+}
+
+TEST( fast_easing, reproducible_bits )
+{
+  // The library computes these easings without fused multiply-adds, thus
+  // these bits must not depend on the target nor on the optimization level.
+  const std::uint32_t expected_float[ 4 ][ 5 ] =
+    {
+      { 0x3c49b6d8, 0x3ddf37f9, 0x3e95f619, 0x3f0bc746, 0x3f57f3e8 },
+      { 0x3b000000, 0x3c000000, 0x3d000000, 0x3e000000, 0x3efffffd },
+      { 0x3b000000, 0xbb80000f, 0xbc7ffff3, 0x3e000000, 0xbe800012 },
+      { 0x3ba44080, 0x3d3caa60, 0x3e0930a4, 0x3e925bde, 0x3f106984 }
+    };
+  const std::uint64_t expected_double[ 4 ][ 5 ] =
+    {
+      { 0x3f8936daf40340af, 0x3fbbe6ff16167522, 0x3fd2bec333019d1b,
+        0x3fe178e8ea5d8fb1, 0x3feafe7d2615ce5f },
+      { 0x3f60000000000000, 0x3f80000000000000, 0x3fa0000000000000,
+        0x3fbffffffffffffd, 0x3fe0000000000001 },
+      { 0x3f5ffffffffe2c27, 0xbf7000000001c027, 0xbf9000000001c03d,
+        0x3fbffffffffe2c24, 0xbfd000000001c02e },
+      { 0x3f74880d9b23ad00, 0x3fa79547ef156ee0, 0x3fc126145e9ecd58,
+        0x3fd24b7bd1512d1e, 0x3fe20d30a2e2f4d4 }
+    };
+
+  float ( * const float_easings[ 4 ] )( float ) =
+    {
+      &tweeners::easing::fast_sine< float >,
+      &tweeners::easing::fast_expo< float >,
+      &tweeners::easing::fast_elastic< float >,
+      &tweeners::easing::fast_circ< float >
+    };
+  double ( * const double_easings[ 4 ] )( double ) =
+    {
+      &tweeners::easing::fast_sine< double >,
+      &tweeners::easing::fast_expo< double >,
+      &tweeners::easing::fast_elastic< double >,
+      &tweeners::easing::fast_circ< double >
+    };
+  const float float_ratios[ 5 ] = { 0.1f, 0.3f, 0.5f, 0.7f, 0.9f };
+  const double double_ratios[ 5 ] = { 0.1, 0.3, 0.5, 0.7, 0.9 };
+
+  for ( int e( 0 ); e != 4; ++e )
+    for ( int i( 0 ); i != 5; ++i )
+      {
+        const float f( float_easings[ e ]( float_ratios[ i ] ) );
+        std::uint32_t f_bits;
+        std::memcpy( &f_bits, &f, sizeof( f ) );
+        EXPECT_EQ( expected_float[ e ][ i ], f_bits )
+          << "easing " << e << ", t=" << float_ratios[ i ];
+
+        const double d( double_easings[ e ]( double_ratios[ i ] ) );
+        std::uint64_t d_bits;
+        std::memcpy( &d_bits, &d, sizeof( d ) );
+        EXPECT_EQ( expected_double[ e ][ i ], d_bits )
+          << "easing " << e << ", t=" << double_ratios[ i ];
+      }
+}
+
+TEST( fast_easing, functions )
+{
+  for ( std::size_t i( 0 ); i != tweeners::easing::id_count; ++i )
+    {
+      const tweeners::easing_id id( static_cast< tweeners::easing_id >( i ) );
+
+      EXPECT_NEAR
+        ( tweeners::easing::function( id )( 0.3 ),
+          tweeners::easing::fast_function( id )( 0.3 ), 2e-6 )
+        << tweeners::easing::name( id );
+    }
+
+  EXPECT_EQ
+    ( &tweeners::easing::fast_circ< float >,
+      tweeners::easing::fast_function( tweeners::easing_id::circ ) );
+  EXPECT_EQ
+    ( &tweeners::easing::fast_sine< float >,
+      tweeners::easing::fast_function( tweeners::easing_id::sine ) );
+}
+
+TEST( fast_easing, config )
+{
+  tweeners::clip_writer writer;
+  writer.add_node( 10, tweeners::easing_id::elastic, 0, 0, 1 );
+
+  std::ostringstream stream;
+  writer.write( stream );
+
+  const std::string bytes( stream.str() );
+  std::vector< std::uint32_t > data
+    ( ( bytes.size() + sizeof( std::uint32_t ) - 1 )
+      / sizeof( std::uint32_t ) );
+  std::memcpy( data.data(), bytes.data(), bytes.size() );
+
+  const tweeners::clip clip
+    ( data.data(), data.size() * sizeof( std::uint32_t ) );
+
+  tweeners::system_base< fast_easing_config > system;
+  float value( -1 );
+  const std::size_t entry( 0 );
+
+  system.instantiate
+    ( clip,
+      tweeners::clip_bindings
+      { system.add_output_buffer( &value, 1 ),
+        tweeners::span< const std::size_t >( &entry, 1 ) } );
+
+  system.update( 5 );
+  EXPECT_EQ( tweeners::easing::fast_elastic( 0.5f ), value );
+}
@@ -0,0 +1,138 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/keyframe_track.hpp"
+#include "tweeners/system.hpp"
+
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST( keyframe_track, values )
+{
+  const tweeners::keyframe_track<> track
+    ( { { 0, 0, tweeners::easing_id::linear },
+        { 10, 100, tweeners::easing_id::linear },
+        { 20, 50, tweeners::easing_id::quad },
+        { 20, 0, tweeners::easing_id::linear },
+        { 40, 10, tweeners::easing_id::linear } } );
+
+  EXPECT_EQ( 40, track.duration() );
+
+  std::size_t cursor( 0 );
+
+  EXPECT_FLOAT_EQ( 0, track.value( 0, cursor ) );
+  EXPECT_FLOAT_EQ( 50, track.value( 0.125, cursor ) );
+  EXPECT_FLOAT_EQ( 100, track.value( 0.25, cursor ) );
+
+  // Quadratic from 100 to 50.
+  EXPECT_FLOAT_EQ( 87.5, track.value( 0.375, cursor ) );
+
+  // Jump to zero at time 20.
+  EXPECT_FLOAT_EQ( 0, track.value( 0.5, cursor ) );
+  EXPECT_FLOAT_EQ( 5, track.value( 0.75, cursor ) );
+  EXPECT_FLOAT_EQ( 10, track.value( 1, cursor ) );
+
+  // Going backward restarts the search.
+  EXPECT_FLOAT_EQ( 50, track.value( 0.125, cursor ) );
+}
+
+TEST( keyframe_track, hold_first_value )
+{
+  const tweeners::keyframe_track<> track
+    ( { { 5, 1, tweeners::easing_id::linear },
+        { 10, 2, tweeners::easing_id::linear } } );
+
+  std::size_t cursor( 0 );
+
+  EXPECT_FLOAT_EQ( 1, track.value( 0, cursor ) );
+  EXPECT_FLOAT_EQ( 1, track.value( 0.5, cursor ) );
+  EXPECT_FLOAT_EQ( 1.5, track.value( 0.75, cursor ) );
+}
+
+TEST( keyframe_track, invalid_keys )
+{
+  using track = tweeners::keyframe_track<>;
+
+  EXPECT_THROW
+    ( track( { { 1, 0, tweeners::easing_id::linear } } ), std::runtime_error );
+  EXPECT_THROW
+    ( track
+      ( { { 0, 0, tweeners::easing_id::linear },
+          { 0, 1, tweeners::easing_id::linear } } ),
+      std::runtime_error );
+  EXPECT_THROW
+    ( track
+      ( { { 2, 0, tweeners::easing_id::linear },
+          { 1, 1, tweeners::easing_id::linear },
+          { 3, 1, tweeners::easing_id::linear } } ),
+      std::runtime_error );
+}
+
+TEST( keyframe_track, single_slot )
+{
+  const tweeners::keyframe_track<> track
+    ( { { 0, 0, tweeners::easing_id::linear },
+        { 10, 10, tweeners::easing_id::linear },
+        { 20, 0, tweeners::easing_id::linear },
+        { 30, 30, tweeners::easing_id::linear } } );
+
+  tweeners::system system;
+  std::vector< float > values;
+  int done_count( 0 );
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .keyframes
+      ( track, [ &values ]( float v ) -> void { values.push_back( v ); } )
+      .on_done( [ &done_count ]() -> void { ++done_count; } )
+      .build( system ) );
+
+  for ( int i( 0 ); i != 5; ++i )
+    system.update( 5 );
+
+  const std::vector< float > expected( { 5, 10, 5, 0, 15 } );
+  ASSERT_EQ( expected.size(), values.size() );
+
+  for ( std::size_t i( 0 ); i != expected.size(); ++i )
+    EXPECT_FLOAT_EQ( expected[ i ], values[ i ] ) << "i=" << i;
+
+  EXPECT_EQ( 0, done_count );
+
+  system.update( 5 );
+  EXPECT_FLOAT_EQ( 30, values.back() );
+  EXPECT_EQ( 1, done_count );
+
+  // Replaying the slot goes through the track again.
+  system.start_slot( slot );
+  system.update( 5 );
+  EXPECT_FLOAT_EQ( 5, values.back() );
+}
+
+TEST( keyframe_track, chrono_duration )
+{
+  using chrono_config = tweeners::config< std::chrono::milliseconds >;
+
+  // The dates of the keys are numbers of milliseconds.
+  const tweeners::keyframe_track<> track
+    ( { { 0, 0, tweeners::easing_id::linear },
+        { 10, 10, tweeners::easing_id::linear },
+        { 20, 0, tweeners::easing_id::linear } } );
+
+  tweeners::system_base< chrono_config > system;
+  std::vector< float > values;
+
+  tweeners::builder_base< chrono_config >()
+    .keyframes
+    ( track, [ &values ]( float v ) -> void { values.push_back( v ); } )
+    .build( system );
+
+  for ( int i( 0 ); i != 4; ++i )
+    system.update( std::chrono::milliseconds( 5 ) );
+
+  const std::vector< float > expected( { 5, 10, 5, 0 } );
+  ASSERT_EQ( expected.size(), values.size() );
+
+  for ( std::size_t i( 0 ); i != expected.size(); ++i )
+    EXPECT_FLOAT_EQ( expected[ i ], values[ i ] ) << "i=" << i;
+}
@@ -0,0 +1,199 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/command_buffer.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <array>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+TEST( output_buffer, system_buffer )
+{
+  tweeners::system system;
+
+  const tweeners::system::id_type slot_1
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, &tweeners::easing::linear< float > )
+      .build( system ) );
+  const tweeners::system::id_type slot_2
+    ( tweeners::builder()
+      .range_transform( 10, 20, 20, &tweeners::easing::linear< float > )
+      .build( system ) );
+
+  EXPECT_TRUE( system.dirty_ranges().empty() );
+
+  system.update( 5 );
+
+  tweeners::span< const float > values( system.output_values() );
+  ASSERT_LT( slot_1, values.size() );
+  ASSERT_LT( slot_2, values.size() );
+  EXPECT_FLOAT_EQ( 50, values[ slot_1 ] );
+  EXPECT_FLOAT_EQ( 12.5, values[ slot_2 ] );
+
+  tweeners::span< const tweeners::output_range > dirty
+    ( system.dirty_ranges() );
+  ASSERT_EQ( 1, dirty.size() );
+  EXPECT_EQ( 0, dirty[ 0 ].begin );
+  EXPECT_EQ( 2, dirty[ 0 ].end );
+
+  system.update( 5 );
+  values = system.output_values();
+  EXPECT_FLOAT_EQ( 100, values[ slot_1 ] );
+  EXPECT_FLOAT_EQ( 15, values[ slot_2 ] );
+
+  // Only the second slot is still running.
+  system.update( 5 );
+  values = system.output_values();
+  EXPECT_FLOAT_EQ( 100, values[ slot_1 ] );
+  EXPECT_FLOAT_EQ( 17.5, values[ slot_2 ] );
+
+  dirty = system.dirty_ranges();
+  ASSERT_EQ( 1, dirty.size() );
+  EXPECT_EQ( slot_2, dirty[ 0 ].begin );
+  EXPECT_EQ( slot_2 + 1, dirty[ 0 ].end );
+
+  system.update( 5 );
+  system.update( 5 );
+  EXPECT_TRUE( system.dirty_ranges().empty() );
+}
+
+TEST( output_buffer, strided_user_buffer )
+{
+  struct vertex
+  {
+    float x;
+    float y;
+  };
+
+  std::array< vertex, 5 > vertices{};
+
+  tweeners::system system;
+  const tweeners::output_buffer buffer
+    ( system.add_output_buffer
+      ( &vertices[ 0 ].y, vertices.size(),
+        sizeof( vertex ) / sizeof( float ) ) );
+
+  for ( std::size_t i : { 0, 1, 3 } )
+    tweeners::builder()
+      .range_transform( 0, i, 10, &tweeners::easing::linear< float > )
+      .output( buffer, i )
+      .build( system );
+
+  system.update( 5 );
+
+  EXPECT_FLOAT_EQ( 0, vertices[ 0 ].y );
+  EXPECT_FLOAT_EQ( 0.5, vertices[ 1 ].y );
+  EXPECT_FLOAT_EQ( 0, vertices[ 2 ].y );
+  EXPECT_FLOAT_EQ( 1.5, vertices[ 3 ].y );
+
+  for ( const vertex& v : vertices )
+    EXPECT_EQ( 0, v.x );
+
+  const tweeners::span< const tweeners::output_range > dirty
+    ( system.dirty_ranges( buffer ) );
+  ASSERT_EQ( 2, dirty.size() );
+  EXPECT_EQ( 0, dirty[ 0 ].begin );
+  EXPECT_EQ( 2, dirty[ 0 ].end );
+  EXPECT_EQ( 3, dirty[ 1 ].begin );
+  EXPECT_EQ( 4, dirty[ 1 ].end );
+
+  // Nothing has been written in the system's buffer.
+  EXPECT_TRUE( system.dirty_ranges().empty() );
+}
+
+TEST( output_buffer, dirty_ranges_across_words )
+{
+  std::array< float, 200 > values{};
+
+  tweeners::system system;
+  const tweeners::output_buffer buffer
+    ( system.add_output_buffer( values.data(), values.size(), 1 ) );
+
+  // The entries are bound in decreasing order, such that they are written in
+  // this order.
+  for ( std::size_t i : { 190, 129, 128, 127, 64, 63, 62, 0 } )
+    tweeners::builder()
+      .range_transform( 0, 1, 10, &tweeners::easing::linear< float > )
+      .output( buffer, i )
+      .build( system );
+
+  system.update( 5 );
+
+  const tweeners::span< const tweeners::output_range > dirty
+    ( system.dirty_ranges( buffer ) );
+  ASSERT_EQ( 4, dirty.size() );
+  EXPECT_EQ( 0, dirty[ 0 ].begin );
+  EXPECT_EQ( 1, dirty[ 0 ].end );
+  EXPECT_EQ( 62, dirty[ 1 ].begin );
+  EXPECT_EQ( 65, dirty[ 1 ].end );
+  EXPECT_EQ( 127, dirty[ 2 ].begin );
+  EXPECT_EQ( 130, dirty[ 2 ].end );
+  EXPECT_EQ( 190, dirty[ 3 ].begin );
+  EXPECT_EQ( 191, dirty[ 3 ].end );
+  EXPECT_FLOAT_EQ( 0.5, values[ 128 ] );
+
+  system.update( 10 );
+  EXPECT_EQ( 4, system.dirty_ranges( buffer ).size() );
+
+  system.update( 1 );
+  EXPECT_TRUE( system.dirty_ranges( buffer ).empty() );
+}
+
+TEST( output_buffer, no_update_callback )
+{
+  tweeners::system system;
+  int value( -1 );
+
+  const tweeners::system::id_type slot
+    ( system.configure_slot
+      ( 10, [ &value ]( float ) -> void { value = 1; },
+        &tweeners::easing::linear< float > ) );
+  system.bind_output( slot, 0, 1 );
+  system.start_slot( slot );
+
+  system.update( 5 );
+  EXPECT_EQ( -1, value );
+  EXPECT_FLOAT_EQ( 0.5, system.output_values()[ slot ] );
+}
+
+TEST( output_buffer, command_buffer )
+{
+  std::array< float, 3 > values{};
+
+  tweeners::system system;
+  const tweeners::output_buffer buffer
+    ( system.add_output_buffer( values.data(), values.size() ) );
+
+  {
+    tweeners::command_buffer commands( system );
+
+    tweeners::builder()
+      .range_transform( 0, 10, 10, &tweeners::easing::linear< float > )
+      .output( buffer, 2 )
+      .build( commands );
+  }
+
+  system.update( 4 );
+  EXPECT_FLOAT_EQ( 4, values[ 2 ] );
+}
+
+TEST( output_buffer, invalid )
+{
+  std::array< float, 3 > values{};
+
+  tweeners::system system;
+  const tweeners::output_buffer buffer
+    ( system.add_output_buffer( values.data(), values.size() ) );
+
+  const tweeners::system::id_type slot
+    ( system.configure_slot
+      ( 10, []( float ) -> void {}, &tweeners::easing::linear< float > ) );
+
+  EXPECT_THROW
+    ( system.bind_output( slot, 0, 1, buffer, 3 ), std::runtime_error );
+  EXPECT_THROW
+    ( system.bind_output( slot + 1, 0, 1, buffer, 0 ), std::runtime_error );
+  EXPECT_THROW
+    ( system.add_output_buffer( nullptr, 1 ), std::runtime_error );
+}
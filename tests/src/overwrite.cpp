@@ -0,0 +1,176 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <gtest/gtest.h>
+
+TEST( system, overwrite_keep_both )
+{
+  int value( -1 );
+  int update_count( 0 );
+  int done_count( 0 );
+
+  tweeners::system system;
+
+  for ( int i( 0 ); i != 2; ++i )
+    tweeners::builder()
+      .range_transform
+      ( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .on_done( [ &done_count ]() -> void { ++done_count; } )
+      .overwrite( tweeners::overwrite_policy::keep_both )
+      .build( system );
+
+  tweeners::builder()
+    .range_transform
+    ( 0, 100, 10,
+      [ &update_count ]( int ) -> void { ++update_count; },
+      &tweeners::easing::linear< float > )
+    .build( system );
+
+  system.update( 10 );
+
+  EXPECT_EQ( 100, value );
+  EXPECT_EQ( 1, update_count );
+  EXPECT_EQ( 2, done_count );
+}
+
+TEST( system, overwrite_replace_existing )
+{
+  int value( -1 );
+  bool first_done( false );
+  bool second_done( false );
+
+  tweeners::system system;
+
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+    .on_done( [ &first_done ]() -> void { first_done = true; } )
+    .overwrite( tweeners::overwrite_policy::keep_both )
+    .build( system );
+
+  system.update( 5 );
+  EXPECT_EQ( 50, value );
+
+  tweeners::builder()
+    .range_transform( 200, 100, 10, value, &tweeners::easing::linear< float > )
+    .on_done( [ &second_done ]() -> void { second_done = true; } )
+    .overwrite( tweeners::overwrite_policy::replace_existing )
+    .build( system );
+
+  system.update( 1 );
+  EXPECT_EQ( 190, value );
+
+  system.update( 9 );
+  EXPECT_EQ( 100, value );
+  EXPECT_FALSE( first_done );
+  EXPECT_TRUE( second_done );
+}
+
+TEST( system, overwrite_queue_after )
+{
+  int value( -1 );
+
+  tweeners::system system;
+
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+    .overwrite( tweeners::overwrite_policy::keep_both )
+    .build( system );
+
+  system.update( 5 );
+  EXPECT_EQ( 50, value );
+
+  tweeners::builder()
+    .range_transform( 100, 0, 10, value, &tweeners::easing::linear< float > )
+    .overwrite( tweeners::overwrite_policy::queue_after )
+    .build( system );
+
+  tweeners::builder()
+    .range_transform( 0, 10, 10, value, &tweeners::easing::linear< float > )
+    .overwrite( tweeners::overwrite_policy::queue_after )
+    .build( system );
+
+  system.update( 1 );
+  EXPECT_EQ( 60, value );
+
+  system.update( 6 );
+  EXPECT_EQ( 80, value );
+
+  system.update( 10 );
+  EXPECT_EQ( 2, value );
+}
+
+TEST( system, overwrite_completed )
+{
+  int value( -1 );
+  bool first_done( false );
+
+  tweeners::system system;
+
+  const tweeners::system::id_type first
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .on_done( [ &first_done ]() -> void { first_done = true; } )
+      .overwrite( tweeners::overwrite_policy::keep_both )
+      .build( system ) );
+
+  system.update( 10 );
+  EXPECT_TRUE( first_done );
+
+  // The first slot is completed, thus it does not conflict anymore.
+  tweeners::builder()
+    .range_transform( 100, 0, 10, value, &tweeners::easing::linear< float > )
+    .overwrite( tweeners::overwrite_policy::queue_after )
+    .build( system );
+
+  system.update( 1 );
+  EXPECT_EQ( 90, value );
+
+  system.remove_slot( first );
+  system.update( 1 );
+  EXPECT_EQ( 80, value );
+}
+
+TEST( system, overwrite_removed )
+{
+  int value( -1 );
+
+  tweeners::system system;
+
+  const tweeners::system::id_type first
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .overwrite( tweeners::overwrite_policy::keep_both )
+      .build( system ) );
+
+  system.remove_slot( first );
+
+  tweeners::builder()
+    .range_transform( 100, 0, 10, value, &tweeners::easing::linear< float > )
+    .overwrite( tweeners::overwrite_policy::queue_after )
+    .build( system );
+
+  system.update( 1 );
+  EXPECT_EQ( 90, value );
+}
+
+TEST( system, overwrite_unbound )
+{
+  int value( -1 );
+
+  tweeners::system system;
+
+  // Without a policy, the tweener is not bound to its target thus the next
+  // one does not see it.
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+    .build( system );
+
+  tweeners::builder()
+    .range_transform( 0, 10, 10, value, &tweeners::easing::linear< float > )
+    .overwrite( tweeners::overwrite_policy::replace_existing )
+    .build( system );
+
+  system.update( 1 );
+  EXPECT_EQ( 2, system.running_count() );
+}
@@ -0,0 +1,202 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/command_buffer.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/parameterized_easing.hpp"
+#include "tweeners/serialization.hpp"
+#include "tweeners/system.hpp"
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST( parameterized_easing, default_parameters )
+{
+  using namespace tweeners::easing;
+
+  for ( int i( 0 ); i <= 100; ++i )
+    {
+      const float t( i / 100.f );
+
+      EXPECT_EQ( elastic( t ), elastic_with( t, 1.f, 0.3f ) ) << "t=" << t;
+      EXPECT_EQ( back( t ), back_with( t, 1.70158f ) ) << "t=" << t;
+      EXPECT_FLOAT_EQ( quad( t ), power( t, 2.f ) ) << "t=" << t;
+      EXPECT_FLOAT_EQ( quint( t ), power( t, 5.f ) ) << "t=" << t;
+    }
+}
+
+TEST( parameterized_easing, variants )
+{
+  using namespace tweeners::easing;
+  using tweeners::parameterized_easing_id;
+
+  const tweeners::parameterized_easing<> elastic_out_easing
+    ( parameterized_easing_id::elastic_out, 1, 0.3 );
+  const tweeners::parameterized_easing<> back_in_out_easing
+    ( parameterized_easing_id::back_in_out, 1.70158 );
+  const tweeners::parameterized_easing<> power_out_easing
+    ( parameterized_easing_id::power_out, 3 );
+
+  for ( int i( 0 ); i <= 100; ++i )
+    {
+      const float t( i / 100.f );
+
+      EXPECT_EQ( ( out< float, &elastic< float > >( t ) ),
+                 elastic_out_easing( t ) ) << "t=" << t;
+      EXPECT_EQ( ( in_out< float, &back< float > >( t ) ),
+                 back_in_out_easing( t ) ) << "t=" << t;
+      EXPECT_NEAR( ( out< float, &cubic< float > >( t ) ),
+                   power_out_easing( t ), 1e-6 ) << "t=" << t;
+    }
+
+  // The default easing is linear.
+  EXPECT_FLOAT_EQ( 0.25, tweeners::parameterized_easing<>()( 0.25 ) );
+}
+
+TEST( parameterized_easing, parameters )
+{
+  using namespace tweeners::easing;
+
+  // A larger amplitude still ends at one.
+  EXPECT_NEAR( 1, elastic_with( 1.f, 2.f, 0.3f ), 1e-6 );
+  EXPECT_GT
+    ( std::abs( elastic_with( 0.9f, 2.f, 0.3f ) ),
+      std::abs( elastic( 0.9f ) ) );
+
+  EXPECT_LT( back_with( 0.3f, 3.f ), back( 0.3f ) );
+
+  EXPECT_EQ( 0, steps( 0.f, 4.f ) );
+  EXPECT_EQ( 0, steps( 0.2f, 4.f ) );
+  EXPECT_EQ( 0.25, steps( 0.3f, 4.f ) );
+  EXPECT_EQ( 0.75, steps( 0.99f, 4.f ) );
+  EXPECT_EQ( 1, steps( 1.f, 4.f ) );
+
+  const tweeners::parameterized_easing<> staircase
+    ( tweeners::parameterized_easing_id::steps, 4.7 );
+  EXPECT_EQ( 4, staircase.first() );
+  EXPECT_EQ( 0.25, staircase( 0.3 ) );
+}
+
+TEST( parameterized_easing, invalid_parameters )
+{
+  using easing = tweeners::parameterized_easing<>;
+  using tweeners::parameterized_easing_id;
+
+  EXPECT_THROW
+    ( easing( parameterized_easing_id::elastic, 1, 0 ), std::runtime_error );
+  EXPECT_THROW
+    ( easing( parameterized_easing_id::steps, 0.5 ), std::runtime_error );
+  EXPECT_THROW
+    ( easing( parameterized_easing_id::power_in_out, 0 ),
+      std::runtime_error );
+  EXPECT_THROW
+    ( easing( static_cast< parameterized_easing_id >( 10 ), 1 ),
+      std::runtime_error );
+}
+
+TEST( parameterized_easing, system )
+{
+  tweeners::system system;
+  tweeners::command_buffer commands( system );
+  const tweeners::parameterized_easing<> staircase
+    ( tweeners::parameterized_easing_id::steps, 2 );
+  float direct_value( -1 );
+  float command_value( -1 );
+  float configured_value( -1 );
+
+  tweeners::builder()
+    .range_transform( 0.f, 10.f, 10, direct_value, staircase )
+    .build( system );
+  tweeners::builder()
+    .range_transform( 0.f, 10.f, 10, command_value, staircase )
+    .build( commands );
+  commands.submit();
+
+  const tweeners::system::id_type slot
+    ( system.configure_slot
+      ( 10, nullptr,
+        tweeners::parameterized_easing<>
+        ( tweeners::parameterized_easing_id::power, 2 ) ) );
+  system.bind_variable( slot, 0, 10, configured_value );
+  system.start_slot( slot );
+
+  system.update( 4 );
+  EXPECT_FLOAT_EQ( 0, direct_value );
+  EXPECT_FLOAT_EQ( 0, command_value );
+  EXPECT_FLOAT_EQ( 1.6, configured_value );
+
+  system.update( 2 );
+  EXPECT_FLOAT_EQ( 5, direct_value );
+  EXPECT_FLOAT_EQ( 5, command_value );
+  EXPECT_FLOAT_EQ( 3.6, configured_value );
+
+  // The slot identifiers are reused with other transforms.
+  system.update( 4 );
+  system.update( 0 );
+
+  float reused_value( -1 );
+  tweeners::builder()
+    .range_transform
+    ( 0.f, 10.f, 10, reused_value, &tweeners::easing::linear< float > )
+    .build( system );
+
+  system.update( 4 );
+  EXPECT_FLOAT_EQ( 4, reused_value );
+}
+
+TEST( parameterized_easing, build_twice )
+{
+  tweeners::system system;
+  tweeners::builder builder;
+
+  builder
+    .range_transform( 0.f, 10.f, 10, []( float t ) -> float { return t; } )
+    .range_transform
+    ( 0.f, 10.f, 10,
+      tweeners::parameterized_easing<>
+      ( tweeners::parameterized_easing_id::steps, 2 ) )
+    .build( system );
+  EXPECT_THROW( builder.build( system ), std::runtime_error );
+}
+
+TEST( parameterized_easing, serialization )
+{
+  std::vector< float > values;
+  tweeners::callback_registry callbacks;
+  callbacks.add_update
+    ( "record", [ &values ]( float v ) -> void { values.push_back( v ); } );
+
+  tweeners::system saved;
+  tweeners::builder()
+    .range_transform
+    ( 0.f, 1.f, 10,
+      [ &values ]( float v ) -> void { values.push_back( v ); },
+      tweeners::parameterized_easing<>
+      ( tweeners::parameterized_easing_id::elastic_out, 2, 0.4 ) )
+    .names( { "record", "", "", "" } )
+    .build( saved );
+
+  saved.update( 3 );
+
+  std::stringstream stream;
+  tweeners::save_system( saved, stream );
+
+  tweeners::system loaded;
+  tweeners::load_system( loaded, stream, callbacks );
+
+  saved.update( 4 );
+  loaded.update( 4 );
+
+  ASSERT_EQ( 3, values.size() );
+  EXPECT_EQ( values[ 1 ], values[ 2 ] );
+  EXPECT_FLOAT_EQ
+    ( tweeners::easing::ease_out
+      ( 0.7f,
+        []( float t ) -> float
+        {
+          return tweeners::easing::elastic_with( t, 2.f, 0.4f );
+        } ),
+      values[ 1 ] );
+}
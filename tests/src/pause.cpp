@@ -0,0 +1,111 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+TEST( system, pause_running )
+{
+  test_helper helper;
+
+  tweener_tracker& tracker( helper.insert( tweeners::system::not_an_id ) );
+
+  helper.system.update( 2 );
+  EXPECT_EQ( 20, tracker.value );
+  EXPECT_EQ( 1, tracker.update_count );
+
+  helper.system.pause_slot( tracker.slot );
+  helper.system.update( 2 );
+
+  EXPECT_EQ( 20, tracker.value );
+  EXPECT_EQ( 1, tracker.update_count );
+
+  helper.system.resume_slot( tracker.slot );
+  helper.system.update( 2 );
+
+  EXPECT_EQ( 40, tracker.value );
+  EXPECT_EQ( 2, tracker.update_count );
+}
+
+TEST( system, pause_before_start )
+{
+  test_helper helper;
+
+  tweener_tracker& tracker( helper.insert( tweeners::system::not_an_id ) );
+
+  helper.system.pause_slot( tracker.slot );
+  helper.system.update( 2 );
+
+  EXPECT_EQ( 1, tracker.start_count );
+  EXPECT_EQ( 0, tracker.update_count );
+
+  helper.system.resume_slot( tracker.slot );
+  helper.system.update( 2 );
+
+  EXPECT_EQ( 20, tracker.value );
+  EXPECT_EQ( 1, tracker.update_count );
+}
+
+TEST( system, pause_successor )
+{
+  test_helper helper;
+
+  tweener_tracker& tracker_1( helper.insert( tweeners::system::not_an_id ) );
+  tweener_tracker& tracker_2( helper.insert( tracker_1.slot ) );
+
+  helper.system.pause_slot( tracker_2.slot );
+  helper.system.update( 15 );
+
+  EXPECT_EQ( 1, tracker_1.done_count );
+  EXPECT_EQ( 1, tracker_2.start_count );
+  EXPECT_EQ( 0, tracker_2.update_count );
+
+  helper.system.resume_slot( tracker_2.slot );
+  helper.system.update( 1 );
+
+  EXPECT_EQ( 1, tracker_2.update_count );
+  EXPECT_EQ( 60, tracker_2.value );
+}
+
+TEST( system, pause_in_earlier_update )
+{
+  int value_1( -1 );
+  int value_2( -1 );
+  int done_count( 0 );
+  tweeners::system system;
+  tweeners::system::id_type slot_2( tweeners::system::not_an_id );
+
+  // The first slot is updated before the second one, after the progression of
+  // both has been computed.
+  tweeners::builder()
+    .range_transform
+    ( 0, 100, 10,
+      [ &system, &slot_2, &value_1 ]( int v ) -> void
+      {
+        system.pause_slot( slot_2 );
+        value_1 = v;
+      },
+      &tweeners::easing::linear< float > )
+    .build( system );
+
+  slot_2 =
+    tweeners::builder()
+    .range_transform( 0, 100, 10, value_2, &tweeners::easing::linear< float > )
+    .on_done( [ &done_count ]() -> void { ++done_count; } )
+    .build( system );
+
+  system.update( 10 );
+  EXPECT_EQ( 100, value_1 );
+  EXPECT_EQ( -1, value_2 );
+  EXPECT_EQ( 0, done_count );
+  EXPECT_EQ( 1, system.running_count() );
+
+  // The paused slot has reached its end, it completes when it is resumed.
+  system.resume_slot( slot_2 );
+  system.update( 0 );
+  EXPECT_EQ( 100, value_2 );
+  EXPECT_EQ( 1, done_count );
+  EXPECT_EQ( 0, system.running_count() );
+}
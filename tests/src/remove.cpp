@@ -329,3 +329,86 @@ TEST( system, remove_with_self_loop_then_replace_slot )
   EXPECT_EQ( 1, tracker_3.update_count );
   EXPECT_EQ( 1, tracker_3.done_count );
 }
+
+TEST( system, remove_completed_in_update )
+{
+  int value_1( -1 );
+  int value_2( -1 );
+  int value_3( -1 );
+  int successor_1( -1 );
+  int successor_2( -1 );
+  int done_count_1( 0 );
+  int done_count_2( 0 );
+
+  tweeners::system system;
+  tweeners::system::id_type slot_1( tweeners::system::not_an_id );
+  tweeners::system::id_type slot_2( tweeners::system::not_an_id );
+
+  // The first two slots complete in the first update. The first one removes
+  // the second one before its update, then the third one removes the first
+  // one after its completion.
+  slot_1 =
+    tweeners::builder()
+    .range_transform
+    ( 0, 100, 10,
+      [ &system, &slot_2, &value_1 ]( int v ) -> void
+      {
+        system.remove_slot( slot_2 );
+        value_1 = v;
+      },
+      &tweeners::easing::linear< float > )
+    .on_done( [ &done_count_1 ]() -> void { ++done_count_1; } )
+    .build( system );
+
+  slot_2 =
+    tweeners::builder()
+    .range_transform( 0, 100, 10, value_2, &tweeners::easing::linear< float > )
+    .on_done( [ &done_count_2 ]() -> void { ++done_count_2; } )
+    .build( system );
+
+  tweeners::builder()
+    .range_transform
+    ( 0, 100, 20,
+      [ &system, &slot_1, &value_3 ]( int v ) -> void
+      {
+        if ( value_3 == -1 )
+          system.remove_slot( slot_1 );
+
+        value_3 = v;
+      },
+      &tweeners::easing::linear< float > )
+    .build( system );
+
+  tweeners::builder()
+    .range_transform
+    ( 0, 100, 10, successor_1, &tweeners::easing::linear< float > )
+    .after( slot_1 )
+    .build( system );
+  tweeners::builder()
+    .range_transform
+    ( 0, 100, 10, successor_2, &tweeners::easing::linear< float > )
+    .after( slot_2 )
+    .build( system );
+
+  system.update( 12 );
+
+  EXPECT_EQ( 100, value_1 );
+  EXPECT_EQ( -1, value_2 );
+  EXPECT_EQ( 60, value_3 );
+  EXPECT_EQ( 0, done_count_1 );
+  EXPECT_EQ( 0, done_count_2 );
+
+  // The first slot has completed before its removal, thus its successor has
+  // been started.
+  EXPECT_EQ( 20, successor_1 );
+  EXPECT_EQ( -1, successor_2 );
+
+  system.update( 10 );
+
+  EXPECT_EQ( 100, value_3 );
+  EXPECT_EQ( 100, successor_1 );
+  EXPECT_EQ( -1, successor_2 );
+  EXPECT_EQ( 0, done_count_1 );
+  EXPECT_EQ( 0, done_count_2 );
+  EXPECT_EQ( 0, system.running_count() );
+}
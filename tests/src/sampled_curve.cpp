@@ -0,0 +1,81 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST( sampled_curve, points )
+{
+  const tweeners::easing::sampled_curve<> curve
+    ( { { 0, 0 }, { 0.25, 0.5 }, { 0.5, 0.8 }, { 1, 1 } }, 8 );
+
+  EXPECT_FLOAT_EQ( 0, curve( 0 ) );
+  EXPECT_FLOAT_EQ( 0.5, curve( 0.25 ) );
+  EXPECT_FLOAT_EQ( 0.8, curve( 0.5 ) );
+  EXPECT_FLOAT_EQ( 1, curve( 1 ) );
+}
+
+TEST( sampled_curve, linear )
+{
+  const tweeners::easing::sampled_curve<> curve
+    ( { { 0, 0 }, { 0.1, 0.1 }, { 0.7, 0.7 }, { 1, 1 } } );
+
+  for ( int i( 0 ); i <= 100; ++i )
+    EXPECT_NEAR( i / 100.f, curve( i / 100.f ), 1e-6 ) << "i=" << i;
+}
+
+TEST( sampled_curve, no_overshoot )
+{
+  // A steep step followed by a plateau overshoots with a Catmull-Rom or a
+  // natural spline.
+  const tweeners::easing::sampled_curve<> curve
+    ( { { 0, 0 }, { 0.4, 0.05 }, { 0.5, 0.9 }, { 0.6, 1 }, { 1, 1 } } );
+
+  float previous( curve( 0 ) );
+
+  for ( int i( 1 ); i <= 1000; ++i )
+    {
+      const float value( curve( i / 1000.f ) );
+
+      EXPECT_LE( previous, value ) << "i=" << i;
+      EXPECT_LE( value, 1 ) << "i=" << i;
+      previous = value;
+    }
+
+  // The plateau stays flat.
+  EXPECT_FLOAT_EQ( 1, curve( 0.8 ) );
+}
+
+TEST( sampled_curve, invalid_points )
+{
+  using curve = tweeners::easing::sampled_curve<>;
+
+  EXPECT_THROW( curve( { { 0, 0 } } ), std::runtime_error );
+  EXPECT_THROW( curve( { { 0.1, 0 }, { 1, 1 } } ), std::runtime_error );
+  EXPECT_THROW( curve( { { 0, 0 }, { 0.9, 1 } } ), std::runtime_error );
+  EXPECT_THROW
+    ( curve( { { 0, 0 }, { 0.5, 0.2 }, { 0.5, 0.3 }, { 1, 1 } } ),
+      std::runtime_error );
+  EXPECT_THROW( curve( { { 0, 0 }, { 1, 1 } }, 0 ), std::runtime_error );
+}
+
+TEST( sampled_curve, transform )
+{
+  tweeners::system system;
+  const tweeners::easing::sampled_curve<> curve
+    ( { { 0, 0 }, { 0.5, 0.25 }, { 1, 1 } } );
+  std::vector< float > values( 100, -1 );
+
+  for ( float& value : values )
+    tweeners::builder()
+      .range_transform( 0.f, 100.f, 10, value, curve )
+      .build( system );
+
+  system.update( 5 );
+
+  for ( float value : values )
+    EXPECT_FLOAT_EQ( 25, value );
+}
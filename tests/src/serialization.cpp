@@ -0,0 +1,389 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/command_buffer.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/serialization.hpp"
+#include "tweeners/system.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  float half_ratio( float t )
+  {
+    return t / 2;
+  }
+
+  struct serialization_values
+  {
+    std::vector< float > updates;
+    int done_count = 0;
+  };
+
+  tweeners::callback_registry
+  serialization_registry( serialization_values& values )
+  {
+    tweeners::callback_registry result;
+
+    result.add_update
+      ( "record",
+        [ &values ]( float v ) -> void
+        {
+          values.updates.push_back( v );
+        } );
+    result.add_transform( "half", &half_ratio );
+    result.add_callback
+      ( "count", [ &values ]() -> void { ++values.done_count; } );
+
+    return result;
+  }
+
+  void build_serialization_scene
+  ( tweeners::system& system, serialization_values& values )
+  {
+    const tweeners::system::id_type first
+      ( tweeners::builder()
+        .range_transform( 0, 100, 10, &tweeners::easing::linear< float > )
+        .names( { "", "linear", "", "count" } )
+        .on_done( [ &values ]() -> void { ++values.done_count; } )
+        .build( system ) );
+
+    tweeners::builder()
+      .range_transform
+      ( 0.f, 1.f, 10,
+        [ &values ]( float v ) -> void { values.updates.push_back( v ); },
+        &half_ratio )
+      .names( { "record", "half", "", "" } )
+      .after( first )
+      .build( system );
+
+    const tweeners::system::id_type removed
+      ( tweeners::builder()
+        .range_transform( 0, 1, 10, &tweeners::easing::linear< float > )
+        .names( { "", "linear", "", "" } )
+        .build( system ) );
+    system.remove_slot( removed );
+  }
+}
+
+TEST( serialization, resume_after_load )
+{
+  serialization_values saved_values;
+  tweeners::system saved;
+  build_serialization_scene( saved, saved_values );
+
+  saved.update( 4 );
+  EXPECT_EQ( 40, saved.output_values()[ 0 ] );
+
+  std::stringstream stream;
+  tweeners::save_system( saved, stream );
+
+  serialization_values loaded_values;
+  tweeners::system loaded;
+  tweeners::load_system
+    ( loaded, stream, serialization_registry( loaded_values ) );
+
+  for ( int i( 0 ); i != 4; ++i )
+    {
+      saved.update( 3 );
+      loaded.update( 3 );
+
+      EXPECT_EQ( saved.output_values()[ 0 ], loaded.output_values()[ 0 ] )
+        << "update " << i;
+    }
+
+  EXPECT_EQ( 1, saved_values.done_count );
+  EXPECT_EQ( 1, loaded_values.done_count );
+  EXPECT_EQ( saved_values.updates, loaded_values.updates );
+  ASSERT_FALSE( loaded_values.updates.empty() );
+  EXPECT_FLOAT_EQ( 0.3, loaded_values.updates.back() );
+
+  // The removed slot is available again in both systems.
+  EXPECT_EQ
+    ( tweeners::builder()
+      .range_transform( 0, 1, 1, &tweeners::easing::linear< float > )
+      .build( saved ),
+      tweeners::builder()
+      .range_transform( 0, 1, 1, &tweeners::easing::linear< float > )
+      .build( loaded ) );
+}
+
+TEST( serialization, pending_start )
+{
+  serialization_values values;
+  tweeners::system saved;
+
+  tweeners::builder()
+    .range_transform( 0, 10, 10, &tweeners::easing::quad< float > )
+    .names( { "", "quad", "", "" } )
+    .build( saved );
+
+  std::stringstream stream;
+  tweeners::save_system( saved, stream );
+
+  tweeners::system loaded;
+  tweeners::load_system( loaded, stream, serialization_registry( values ) );
+
+  saved.update( 5 );
+  loaded.update( 5 );
+
+  EXPECT_EQ( 2.5, loaded.output_values()[ 0 ] );
+  EXPECT_EQ( saved.output_values()[ 0 ], loaded.output_values()[ 0 ] );
+}
+
+TEST( serialization, easing_without_name )
+{
+  serialization_values saved_values;
+  tweeners::system saved;
+  tweeners::command_buffer commands( saved );
+  const auto record
+    ( [ &saved_values ]( float v ) -> void
+      {
+        saved_values.updates.push_back( v );
+      } );
+
+  const tweeners::system::id_type configured
+    ( saved.configure_slot( 10, record, tweeners::easing_id::sine ) );
+  saved.set_slot_names( configured, { "record", "", "", "" } );
+  saved.start_slot( configured );
+
+  tweeners::builder()
+    .range_transform( 0.f, 1.f, 10, record, &tweeners::easing::expo< float > )
+    .names( { "record", "", "", "" } )
+    .build( saved );
+
+  tweeners::builder()
+    .range_transform
+    ( 0.f, 1.f, 10, record, &tweeners::easing::quad< float > )
+    .names( { "record", "", "", "" } )
+    .build( commands );
+  commands.submit();
+
+  saved.update( 3 );
+
+  std::stringstream stream;
+  tweeners::save_system( saved, stream );
+
+  serialization_values loaded_values;
+  tweeners::system loaded;
+  tweeners::load_system
+    ( loaded, stream, serialization_registry( loaded_values ) );
+
+  saved_values.updates.clear();
+  saved.update( 4 );
+  loaded.update( 4 );
+
+  ASSERT_EQ( 3, saved_values.updates.size() );
+  EXPECT_EQ( saved_values.updates, loaded_values.updates );
+}
+
+TEST( serialization, unnamed_function )
+{
+  tweeners::system system;
+
+  tweeners::builder()
+    .range_transform( 0, 1, 10, &tweeners::easing::linear< float > )
+    .on_done( []() -> void {} )
+    .names( { "", "linear", "", "" } )
+    .build( system );
+
+  std::stringstream stream;
+  EXPECT_THROW( tweeners::save_system( system, stream ), std::runtime_error );
+}
+
+TEST( serialization, unknown_function )
+{
+  serialization_values values;
+  tweeners::system saved;
+  build_serialization_scene( saved, values );
+
+  std::stringstream stream;
+  tweeners::save_system( saved, stream );
+
+  tweeners::system loaded;
+  EXPECT_THROW
+    ( tweeners::load_system( loaded, stream, tweeners::callback_registry() ),
+      std::runtime_error );
+}
+
+TEST( serialization, invalid_data )
+{
+  tweeners::system system;
+  tweeners::callback_registry callbacks;
+
+  std::stringstream garbage( "not a system" );
+  EXPECT_THROW
+    ( tweeners::load_system( system, garbage, callbacks ),
+      std::runtime_error );
+
+  serialization_values values;
+  tweeners::system saved;
+  build_serialization_scene( saved, values );
+
+  std::stringstream stream;
+  tweeners::save_system( saved, stream );
+
+  const std::string data( stream.str() );
+  std::stringstream truncated( data.substr( 0, data.size() / 2 ) );
+
+  EXPECT_THROW
+    ( tweeners::load_system
+      ( system, truncated, serialization_registry( values ) ),
+      std::runtime_error );
+}
+
+TEST( serialization, inconsistent_queues )
+{
+  serialization_values values;
+  tweeners::system saved;
+  build_serialization_scene( saved, values );
+  saved.update( 4 );
+
+  std::stringstream stream;
+  tweeners::save_system( saved, stream );
+
+  // The data ends with the available identifiers, i.e. the removed slot, then
+  // the slots to update, i.e. the first slot.
+  const std::string data( stream.str() );
+  const std::size_t id_size( sizeof( tweeners::system::id_type ) );
+  const std::size_t available_offset
+    ( data.size() - id_size - sizeof( std::uint64_t ) - id_size );
+  const std::size_t update_offset( data.size() - id_size );
+
+  const auto load_with_id
+    ( [ &data, &values ]
+      ( std::size_t offset, tweeners::system::id_type id ) -> void
+      {
+        std::string corrupted( data );
+        std::memcpy( &corrupted[ offset ], &id, sizeof( id ) );
+
+        std::stringstream corrupted_stream( corrupted );
+        tweeners::system system;
+        tweeners::load_system
+          ( system, corrupted_stream, serialization_registry( values ) );
+      } );
+
+  EXPECT_NO_THROW( load_with_id( available_offset, 2 ) );
+  EXPECT_NO_THROW( load_with_id( update_offset, 0 ) );
+
+  // The running slot is listed in the available identifiers.
+  EXPECT_THROW( load_with_id( available_offset, 0 ), std::runtime_error );
+
+  // The ready slot is scheduled for an update.
+  EXPECT_THROW( load_with_id( update_offset, 1 ), std::runtime_error );
+}
+
+TEST( serialization, load_in_non_empty_system )
+{
+  serialization_values values;
+  tweeners::system saved;
+  build_serialization_scene( saved, values );
+
+  std::stringstream stream;
+  tweeners::save_system( saved, stream );
+
+  EXPECT_THROW
+    ( tweeners::load_system( saved, stream, serialization_registry( values ) ),
+      std::runtime_error );
+}
+
+TEST( serialization, ids_given_to_command_buffers )
+{
+  serialization_values values;
+  tweeners::system saved;
+  tweeners::command_buffer commands( saved );
+
+  const auto configure
+    ( []( tweeners::system& system ) -> tweeners::system::id_type
+      {
+        return system.configure_slot
+          ( 1, []( float ) -> void {}, &tweeners::easing::linear< float > );
+      } );
+
+  saved.remove_slot( configure( saved ) );
+  saved.remove_slot( configure( saved ) );
+  saved.update( 1 );
+
+  // The buffer receives one of the two available identifiers when its
+  // configured slot is applied.
+  tweeners::builder()
+    .range_transform( 0, 1, 10, &tweeners::easing::linear< float > )
+    .names( { "", "linear", "", "" } )
+    .build( commands );
+  commands.submit();
+  saved.update( 1 );
+
+  std::stringstream stream;
+  tweeners::save_system( saved, stream );
+
+  tweeners::system system;
+  tweeners::load_system( system, stream, serialization_registry( values ) );
+
+  // Both identifiers are available in the loaded system.
+  EXPECT_EQ( 1, configure( system ) + configure( system ) );
+}
+
+TEST( serialization, many_slots )
+{
+  // The loaded queues and sequences are checked in a time linear in the
+  // number of slots. The internal checks of the debug builds are much
+  // slower, thus the smaller count.
+#ifdef TWEENERS_DEBUG
+  const tweeners::system::id_type slot_count( 90 );
+#else
+  const tweeners::system::id_type slot_count( 30000 );
+#endif
+
+  serialization_values values;
+  tweeners::system saved;
+
+  const auto configure
+    ( [ &saved ]() -> tweeners::system::id_type
+      {
+        const tweeners::system::id_type result
+          ( saved.configure_slot
+            ( 10, tweeners::system::update_function(),
+              tweeners::easing_id::linear ) );
+        saved.bind_output( result, 0, 100 );
+        return result;
+      } );
+
+  // A third of the slots is running, a third is removed and the last third
+  // follows the running slots.
+  for ( tweeners::system::id_type i( 0 ); i != slot_count; i += 3 )
+    {
+      const tweeners::system::id_type running( configure() );
+      saved.start_slot( running );
+      saved.remove_slot( configure() );
+      saved.play_in_sequence( running, configure() );
+    }
+
+  saved.update( 4 );
+
+  // The slots configured now take the removed identifiers and are started in
+  // the next update.
+  for ( tweeners::system::id_type i( 0 ); i != slot_count; i += 6 )
+    saved.start_slot( configure() );
+
+  std::stringstream stream;
+  tweeners::save_system( saved, stream );
+
+  tweeners::system loaded;
+  tweeners::load_system( loaded, stream, serialization_registry( values ) );
+
+  saved.update( 8 );
+  loaded.update( 8 );
+
+  const tweeners::span< const float > saved_values( saved.output_values() );
+  const tweeners::span< const float > loaded_values( loaded.output_values() );
+
+  ASSERT_EQ( saved_values.size(), loaded_values.size() );
+
+  for ( std::size_t i( 0 ); i != saved_values.size(); ++i )
+    EXPECT_EQ( saved_values[ i ], loaded_values[ i ] ) << i;
+}
@@ -1,5 +1,7 @@
 #include "tweeners/detail/slot_component.hpp"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 TEST( slot_component, insert )
@@ -110,3 +112,71 @@ TEST( slot_component, get_existing )
 
   EXPECT_EQ( 11, values.get_existing( 1 ) );
 }
+
+TEST( slot_component, emplace_twice )
+{
+  constexpr int guard( 42 );
+  tweeners::detail::slot_component< int, int > values( guard );
+
+  values.add_one_slot_at_end();
+  values.add_one_slot_at_end();
+
+  values.emplace( 1, 11 );
+  values.emplace( 0, 22 );
+  values.emplace( 1, 33 );
+
+  EXPECT_EQ( 22, values[ 0 ] );
+  EXPECT_EQ( 33, values[ 1 ] );
+
+  const int to_remove[] = { 1 };
+  values.erase( std::begin( to_remove ), std::end( to_remove ) );
+
+  EXPECT_EQ( 22, values[ 0 ] );
+  EXPECT_EQ( guard, values[ 1 ] );
+  EXPECT_FALSE( values.has_value( 1 ) );
+}
+
+TEST( slot_component, many_slots )
+{
+  constexpr int guard( 42 );
+  constexpr int slot_count( 1000 );
+  tweeners::detail::slot_component< int, std::int16_t > values( guard );
+
+  for ( int i( 0 ); i != slot_count; ++i )
+    values.add_one_slot_at_end();
+
+  for ( int i( 0 ); i < slot_count; i += 7 )
+    values.emplace( i, i );
+
+  for ( int i( 0 ); i != slot_count; ++i )
+    if ( i % 7 == 0 )
+      {
+        EXPECT_TRUE( values.has_value( i ) ) << "i=" << i;
+        EXPECT_EQ( i, values[ i ] ) << "i=" << i;
+      }
+    else
+      {
+        EXPECT_FALSE( values.has_value( i ) ) << "i=" << i;
+        EXPECT_EQ( guard, values[ i ] ) << "i=" << i;
+      }
+
+  std::vector< int > to_remove;
+
+  for ( int i( 0 ); i < slot_count; i += 14 )
+    to_remove.push_back( i );
+
+  values.erase( to_remove.begin(), to_remove.end() );
+
+  for ( int i( 0 ); i != slot_count; ++i )
+    if ( i % 14 == 7 )
+      EXPECT_EQ( i, values[ i ] ) << "i=" << i;
+    else
+      EXPECT_EQ( guard, values[ i ] ) << "i=" << i;
+
+  values.emplace( 0, -1 );
+  values.emplace( 999, -2 );
+
+  EXPECT_EQ( -1, values[ 0 ] );
+  EXPECT_EQ( -2, values[ 999 ] );
+  EXPECT_EQ( 7, values.get_existing( 7 ) );
+}
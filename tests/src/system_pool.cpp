@@ -0,0 +1,142 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system_pool.hpp"
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+TEST( system_pool, owned_and_borrowed )
+{
+  constexpr std::size_t owned_count( 10 );
+
+  tweeners::system borrowed;
+  int borrowed_value( -1 );
+
+  tweeners::builder()
+    .range_transform
+    ( 0, 100, 20, borrowed_value, &tweeners::easing::linear< float > )
+    .build( borrowed );
+
+  tweeners::system_pool pool( 3 );
+  EXPECT_EQ( 3, pool.thread_count() );
+
+  std::vector< std::size_t > indices;
+  std::vector< int > values( owned_count, -1 );
+
+  for ( std::size_t i( 0 ); i != owned_count; ++i )
+    {
+      indices.push_back( pool.emplace() );
+
+      tweeners::builder()
+        .range_transform
+        ( 0, 100, 10, values[ i ], &tweeners::easing::linear< float > )
+        .build( pool.get( indices.back() ) );
+    }
+
+  const std::size_t borrowed_index( pool.add( borrowed ) );
+  EXPECT_EQ( &borrowed, &pool.get( borrowed_index ) );
+  EXPECT_EQ( owned_count + 1, pool.size() );
+
+  pool.update( 5 );
+
+  for ( int v : values )
+    EXPECT_EQ( 50, v );
+
+  EXPECT_EQ( 25, borrowed_value );
+
+  pool.update( 5 );
+
+  for ( int v : values )
+    EXPECT_EQ( 100, v );
+
+  EXPECT_EQ( 50, borrowed_value );
+
+  for ( std::size_t i : indices )
+    EXPECT_EQ( 0, pool.get( i ).running_count() );
+
+  EXPECT_EQ( 1, borrowed.running_count() );
+
+  // The removed borrowed system is not updated anymore.
+  pool.remove( borrowed_index );
+  EXPECT_EQ( owned_count, pool.size() );
+
+  pool.update( 5 );
+  EXPECT_EQ( 50, borrowed_value );
+
+  EXPECT_THROW( pool.get( borrowed_index ), std::runtime_error );
+
+  // The index is recycled.
+  EXPECT_EQ( borrowed_index, pool.emplace() );
+}
+
+TEST( system_pool, update_cost )
+{
+  tweeners::system_pool pool( 2 );
+
+  const std::size_t index( pool.emplace() );
+  EXPECT_EQ( 0, pool.update_cost( index ).count() );
+
+  int value( -1 );
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+    .build( pool.get( index ) );
+
+  pool.update( 1 );
+  EXPECT_LT( 0, pool.update_cost( index ).count() );
+}
+
+TEST( system_pool, single_thread )
+{
+  tweeners::system_pool pool( 1 );
+  EXPECT_EQ( 0, pool.size() );
+
+  // Nothing to update.
+  pool.update( 1 );
+
+  int value( -1 );
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+    .build( pool.get( pool.emplace() ) );
+
+  pool.update( 3 );
+  EXPECT_EQ( 30, value );
+}
+
+TEST( system_pool, exception )
+{
+  constexpr std::size_t system_count( 8 );
+
+  tweeners::system_pool pool( 4 );
+  std::vector< int > values( system_count, -1 );
+
+  for ( std::size_t i( 0 ); i != system_count; ++i )
+    {
+      tweeners::system& system( pool.get( pool.emplace() ) );
+
+      if ( i == 3 )
+        tweeners::builder()
+          .range_transform
+          ( 0, 1, 10,
+            []( float ) -> void
+            {
+              throw std::logic_error( "test" );
+            },
+            &tweeners::easing::linear< float > )
+          .build( system );
+
+      tweeners::builder()
+        .range_transform
+        ( 0, 100, 10, values[ i ], &tweeners::easing::linear< float > )
+        .build( system );
+    }
+
+  EXPECT_THROW( pool.update( 5 ), std::logic_error );
+
+  // The other systems have been updated.
+  for ( std::size_t i( 0 ); i != system_count; ++i )
+    if ( i != 3 )
+      {
+        EXPECT_EQ( 50, values[ i ] );
+      }
+}
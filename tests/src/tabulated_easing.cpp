@@ -0,0 +1,70 @@
+#include "tweeners/easing.hpp"
+#include "tweeners/easing_id.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+TEST( tabulated_easing, max_error )
+{
+  using namespace tweeners::easing;
+
+  EXPECT_LT( ( tabulated_max_error< float, &sine< float > >() ), 1e-5 );
+  EXPECT_LT( ( tabulated_max_error< float, &expo< float > >() ), 1e-3 );
+  EXPECT_LT( ( tabulated_max_error< float, &elastic< float > >() ), 1e-3 );
+  EXPECT_LT
+    ( ( tabulated_max_error< float, &out< float, &elastic< float > > >() ),
+      1e-3 );
+
+  // circ has an infinite derivative at 1, where the error is the largest.
+  EXPECT_LT( ( tabulated_max_error< float, &circ< float > >() ), 0.1 );
+
+  // A finer table is more accurate.
+  EXPECT_LT
+    ( ( tabulated_max_error< float, &elastic< float >, 1024 >() ),
+      ( tabulated_max_error< float, &elastic< float >, 256 >() ) );
+}
+
+TEST( tabulated_easing, error_is_measured )
+{
+  using namespace tweeners::easing;
+
+  const float max_error
+    ( tabulated_max_error< float, &in_out< float, &expo< float > >, 32 >() );
+  float error( 0 );
+
+  for ( int i( 0 ); i <= 10000; ++i )
+    {
+      const float t( i / 10000.f );
+      error =
+        std::max
+        ( error,
+          std::abs
+          ( tabulated< float, &in_out< float, &expo< float > >, 32 >( t )
+            - in_out< float, &expo< float > >( t ) ) );
+    }
+
+  // The measured error is sampled, thus it may be slightly underestimated.
+  EXPECT_GT( error, 0 );
+  EXPECT_LE( error, max_error * 1.01 );
+  EXPECT_GT( error, max_error / 2 );
+}
+
+TEST( tabulated_easing, bounds )
+{
+  for ( std::size_t i( 0 ); i != tweeners::easing::id_count; ++i )
+    {
+      const tweeners::easing_id id( static_cast< tweeners::easing_id >( i ) );
+      float ( * const exact )( float )( tweeners::easing::function( id ) );
+      float ( * const approximation )( float )
+        ( tweeners::easing::tabulated_function( id ) );
+
+      EXPECT_EQ( exact( 0 ), approximation( 0 ) )
+        << tweeners::easing::name( id );
+      EXPECT_EQ( exact( 1 ), approximation( 1 ) )
+        << tweeners::easing::name( id );
+      EXPECT_NEAR( exact( 0.3 ), approximation( 0.3 ), 1e-2 )
+        << tweeners::easing::name( id );
+    }
+}
@@ -0,0 +1,209 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+TEST( system, remove_tagged )
+{
+  int value_1( -1 );
+  int value_2( -1 );
+  int value_3( -1 );
+
+  tweeners::system system;
+
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value_1, &tweeners::easing::linear< float > )
+    .tag( 1 )
+    .build( system );
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value_2, &tweeners::easing::linear< float > )
+    .tag( 2 )
+    .build( system );
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value_3, &tweeners::easing::linear< float > )
+    .tag( 1 )
+    .build( system );
+
+  system.update( 1 );
+  EXPECT_EQ( 10, value_1 );
+  EXPECT_EQ( 10, value_2 );
+  EXPECT_EQ( 10, value_3 );
+
+  system.remove_tagged( 1 );
+  system.update( 1 );
+  EXPECT_EQ( 10, value_1 );
+  EXPECT_EQ( 20, value_2 );
+  EXPECT_EQ( 10, value_3 );
+
+  int count( 0 );
+  system.for_each_tagged
+    ( 1, [ &count ]( tweeners::system::id_type ) -> void { ++count; } );
+  EXPECT_EQ( 0, count );
+
+  system.for_each_tagged
+    ( 2, [ &count ]( tweeners::system::id_type ) -> void { ++count; } );
+  EXPECT_EQ( 1, count );
+}
+
+TEST( system, remove_tagged_then_slot )
+{
+  int value( -1 );
+  tweeners::system system;
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .tag( 1 )
+      .build( system ) );
+
+  system.remove_slot( slot );
+  system.remove_tagged( 1 );
+  system.update( 1 );
+
+  EXPECT_EQ( -1, value );
+
+  // The slot id must have been recycled only once.
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+    .build( system );
+
+  const tweeners::system::id_type other
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .build( system ) );
+
+  EXPECT_NE( slot, other );
+}
+
+TEST( system, pause_tagged )
+{
+  int value_1( -1 );
+  int value_2( -1 );
+
+  tweeners::system system;
+
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value_1, &tweeners::easing::linear< float > )
+    .tag( 1 )
+    .build( system );
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value_2, &tweeners::easing::linear< float > )
+    .tag( 2 )
+    .build( system );
+
+  system.update( 1 );
+  system.pause_tagged( 1 );
+  system.update( 1 );
+
+  EXPECT_EQ( 10, value_1 );
+  EXPECT_EQ( 20, value_2 );
+
+  system.resume_tagged( 1 );
+  system.update( 1 );
+
+  EXPECT_EQ( 20, value_1 );
+  EXPECT_EQ( 30, value_2 );
+}
+
+TEST( system, for_each_tagged )
+{
+  int value;
+  tweeners::system system;
+
+  std::vector< tweeners::system::id_type > slots;
+
+  for ( int i( 0 ); i != 6; ++i )
+    slots.push_back
+      ( tweeners::builder()
+        .range_transform
+        ( 0, 100, 10, value, &tweeners::easing::linear< float > )
+        .tag( i % 2 )
+        .build( system ) );
+
+  std::vector< tweeners::system::id_type > visited;
+
+  system.for_each_tagged
+    ( 1,
+      [ &visited ]( tweeners::system::id_type slot ) -> void
+      {
+        visited.push_back( slot );
+      } );
+
+  std::sort( visited.begin(), visited.end() );
+
+  ASSERT_EQ( 3u, visited.size() );
+  EXPECT_EQ( slots[ 1 ], visited[ 0 ] );
+  EXPECT_EQ( slots[ 3 ], visited[ 1 ] );
+  EXPECT_EQ( slots[ 5 ], visited[ 2 ] );
+}
+
+TEST( system, change_tag )
+{
+  int value( -1 );
+  tweeners::system system;
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .tag( 1 )
+      .build( system ) );
+
+  system.tag_slot( slot, 2 );
+  system.remove_tagged( 1 );
+  system.update( 1 );
+
+  EXPECT_EQ( 10, value );
+
+  system.remove_tagged( 2 );
+  system.update( 1 );
+
+  EXPECT_EQ( 10, value );
+}
+
+TEST( system, remove_tagged_out_of_order )
+{
+  int value;
+  tweeners::system system;
+
+  std::vector< tweeners::system::id_type > slots;
+
+  for ( int i( 0 ); i != 20; ++i )
+    slots.push_back
+      ( tweeners::builder()
+        .range_transform
+        ( 0, 100, 10, value, &tweeners::easing::linear< float > )
+        .tag( 1 )
+        .build( system ) );
+
+  // Each removal moves the last slot of the tag in place of the removed one.
+  for ( int i : { 3, 0, 19, 10, 11, 7 } )
+    system.remove_slot( slots[ i ] );
+
+  system.tag_slot( slots[ 5 ], 2 );
+  system.update( 1 );
+
+  std::vector< tweeners::system::id_type > visited;
+
+  system.for_each_tagged
+    ( 1,
+      [ &visited ]( tweeners::system::id_type slot ) -> void
+      {
+        visited.push_back( slot );
+      } );
+
+  std::sort( visited.begin(), visited.end() );
+
+  const std::vector< tweeners::system::id_type > expected
+    ( { slots[ 1 ], slots[ 2 ], slots[ 4 ], slots[ 6 ], slots[ 8 ],
+        slots[ 9 ], slots[ 12 ], slots[ 13 ], slots[ 14 ], slots[ 15 ],
+        slots[ 16 ], slots[ 17 ], slots[ 18 ] } );
+  EXPECT_EQ( expected, visited );
+
+  system.remove_tagged( 1 );
+  system.update( 1 );
+
+  EXPECT_EQ( 1u, system.running_count() );
+}
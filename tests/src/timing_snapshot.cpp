@@ -0,0 +1,239 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+TEST( timing_snapshot, restore )
+{
+  tweeners::system system;
+  int value_1( -1 );
+  int value_2( -1 );
+  int done_count( 0 );
+
+  const tweeners::system::id_type slot_1
+    ( tweeners::builder()
+      .range_transform
+      ( 0, 100, 10, value_1, &tweeners::easing::linear< float > )
+      .on_done( [ &done_count ]() -> void { ++done_count; } )
+      .build( system ) );
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value_2, &tweeners::easing::linear< float > )
+    .after( slot_1 )
+    .build( system );
+
+  system.update( 4 );
+  EXPECT_EQ( 40, value_1 );
+
+  tweeners::system::timing_snapshot snapshot;
+  system.save_timing( snapshot );
+
+  system.update( 8 );
+  EXPECT_EQ( 100, value_1 );
+  EXPECT_EQ( 20, value_2 );
+  EXPECT_EQ( 1, done_count );
+
+  system.restore_timing( snapshot );
+
+  // Nothing is called by the restoration.
+  EXPECT_EQ( 100, value_1 );
+  EXPECT_EQ( 20, value_2 );
+
+  system.update( 2 );
+  EXPECT_EQ( 60, value_1 );
+  EXPECT_EQ( 20, value_2 );
+
+  system.update( 6 );
+  EXPECT_EQ( 100, value_1 );
+  EXPECT_EQ( 20, value_2 );
+  EXPECT_EQ( 2, done_count );
+
+  // The snapshot can be restored several times.
+  system.restore_timing( snapshot );
+  system.update( 1 );
+  EXPECT_EQ( 50, value_1 );
+}
+
+TEST( timing_snapshot, pause_and_remove )
+{
+  tweeners::system system;
+  int value( -1 );
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .build( system ) );
+
+  system.update( 1 );
+
+  tweeners::system::timing_snapshot snapshot;
+  system.save_timing( snapshot );
+
+  system.pause_slot( slot );
+  system.update( 1 );
+  EXPECT_EQ( 10, value );
+
+  system.restore_timing( snapshot );
+  system.update( 1 );
+  EXPECT_EQ( 20, value );
+
+  system.save_timing( snapshot );
+
+  // The removal is not applied until the next update, thus it can be undone.
+  system.remove_slot( slot );
+  system.restore_timing( snapshot );
+  system.update( 1 );
+  EXPECT_EQ( 30, value );
+}
+
+TEST( timing_snapshot, invalid )
+{
+  tweeners::system system;
+  tweeners::system other;
+  int value( -1 );
+
+  tweeners::system::timing_snapshot snapshot;
+  EXPECT_THROW( system.restore_timing( snapshot ), std::runtime_error );
+
+  other.save_timing( snapshot );
+  EXPECT_THROW( system.restore_timing( snapshot ), std::runtime_error );
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .build( system ) );
+  const tweeners::system::id_type other_slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .build( system ) );
+
+  system.save_timing( snapshot );
+  system.play_in_sequence( slot, other_slot );
+  EXPECT_THROW( system.restore_timing( snapshot ), std::runtime_error );
+
+  system.save_timing( snapshot );
+  system.remove_slot( slot );
+  system.update( 1 );
+  EXPECT_THROW( system.restore_timing( snapshot ), std::runtime_error );
+
+  // The identifier of the removed slot is reused by a new slot.
+  const tweeners::system::id_type new_slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .build( system ) );
+  EXPECT_EQ( slot, new_slot );
+  EXPECT_THROW( system.restore_timing( snapshot ), std::runtime_error );
+}
+
+TEST( timing_snapshot, created_slots )
+{
+  tweeners::system system;
+  int value( -1 );
+  int new_value( -1 );
+  int sequenced_value( -1 );
+  int done_count( 0 );
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .build( system ) );
+
+  system.update( 2 );
+
+  tweeners::system::timing_snapshot snapshot;
+  system.save_timing( snapshot );
+
+  const tweeners::system::id_type new_slot
+    ( tweeners::builder()
+      .range_transform
+      ( 0, 100, 10, new_value, &tweeners::easing::linear< float > )
+      .on_done( [ &done_count ]() -> void { ++done_count; } )
+      .build( system ) );
+  const tweeners::system::id_type sequenced_slot
+    ( tweeners::builder()
+      .range_transform
+      ( 0, 100, 10, sequenced_value, &tweeners::easing::linear< float > )
+      .after( slot )
+      .build( system ) );
+
+  system.tag_slot( new_slot, 1 );
+  system.tag_slot( sequenced_slot, 1 );
+
+  system.update( 1 );
+  EXPECT_EQ( 30, value );
+  EXPECT_EQ( 10, new_value );
+  EXPECT_EQ( 2, system.running_count() );
+
+  system.restore_timing( snapshot );
+  EXPECT_EQ( 1, system.running_count() );
+
+  int tagged_count( 0 );
+  system.for_each_tagged
+    ( 1,
+      [ &tagged_count ]( tweeners::system::id_type ) -> void
+      {
+        ++tagged_count;
+      } );
+  EXPECT_EQ( 0, tagged_count );
+
+  // The removed slots are neither updated nor completed, nor continuing the
+  // slot of the snapshot.
+  system.update( 10 );
+  EXPECT_EQ( 100, value );
+  EXPECT_EQ( 10, new_value );
+  EXPECT_EQ( -1, sequenced_value );
+  EXPECT_EQ( 0, done_count );
+  EXPECT_EQ( 0, system.running_count() );
+
+  // The identifiers of the removed slots are available again.
+  const tweeners::system::id_type reused_slot
+    ( tweeners::builder()
+      .range_transform
+      ( 0, 100, 10, new_value, &tweeners::easing::linear< float > )
+      .build( system ) );
+  EXPECT_TRUE
+    ( ( reused_slot == new_slot ) || ( reused_slot == sequenced_slot ) );
+}
+
+TEST( timing_snapshot, restore_after_created_slots )
+{
+  tweeners::system system;
+  int value( -1 );
+  int new_value( -1 );
+
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+    .build( system );
+
+  system.update( 2 );
+
+  tweeners::system::timing_snapshot before;
+  system.save_timing( before );
+
+  tweeners::builder()
+    .range_transform
+    ( 0, 100, 10, new_value, &tweeners::easing::linear< float > )
+    .build( system );
+
+  system.update( 1 );
+
+  tweeners::system::timing_snapshot after;
+  system.save_timing( after );
+
+  // Restoring the first snapshot removes the slot created since then, thus
+  // the second snapshot cannot be restored anymore while the first one can.
+  system.restore_timing( before );
+  EXPECT_EQ( 1, system.running_count() );
+
+  EXPECT_THROW( system.restore_timing( after ), std::runtime_error );
+
+  system.update( 3 );
+  EXPECT_EQ( 50, value );
+
+  system.restore_timing( before );
+  system.update( 1 );
+  EXPECT_EQ( 30, value );
+  EXPECT_EQ( 1, system.running_count() );
+}
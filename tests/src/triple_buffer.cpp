@@ -0,0 +1,133 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+#include "tweeners/triple_buffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST( triple_buffer, latest )
+{
+  tweeners::triple_buffer< int > buffer( -1 );
+
+  EXPECT_EQ( -1, buffer.acquire_latest() );
+
+  buffer.write_buffer() = 1;
+  EXPECT_EQ( -1, buffer.acquire_latest() );
+
+  buffer.publish();
+  EXPECT_EQ( 1, buffer.acquire_latest() );
+  EXPECT_EQ( 1, buffer.acquire_latest() );
+
+  // Only the latest value is received.
+  buffer.write_buffer() = 2;
+  buffer.publish();
+  buffer.write_buffer() = 3;
+  buffer.publish();
+  EXPECT_EQ( 3, buffer.acquire_latest() );
+
+  buffer.write_buffer() = 4;
+  buffer.publish();
+  buffer.write_buffer() = 5;
+  EXPECT_EQ( 4, buffer.acquire_latest() );
+}
+
+TEST( triple_buffer, concurrent )
+{
+  constexpr int frame_count( 10000 );
+  constexpr std::size_t value_count( 64 );
+
+  tweeners::triple_buffer< std::vector< int > > buffer
+    ( std::vector< int >( value_count, 0 ) );
+  std::atomic< bool > torn( false );
+
+  std::thread reader
+    ( [ & ]() -> void
+      {
+        int last( 0 );
+
+        while ( last != frame_count )
+          {
+            const std::vector< int >& values( buffer.acquire_latest() );
+            const int frame( values[ 0 ] );
+
+            if ( ( frame < last )
+                 || ( std::count( values.begin(), values.end(), frame )
+                      != int( value_count ) ) )
+              {
+                torn = true;
+                return;
+              }
+
+            last = frame;
+          }
+      } );
+
+  for ( int frame( 1 ); frame <= frame_count; ++frame )
+    {
+      std::vector< int >& values( buffer.write_buffer() );
+      std::fill( values.begin(), values.end(), frame );
+      buffer.publish();
+    }
+
+  reader.join();
+  EXPECT_FALSE( torn );
+}
+
+TEST( triple_buffer, system_outputs )
+{
+  tweeners::system system;
+  tweeners::system::output_snapshots snapshots;
+
+  system.publish_outputs( &snapshots );
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, &tweeners::easing::linear< float > )
+      .build( system ) );
+
+  EXPECT_TRUE( snapshots.acquire_latest().empty() );
+
+  system.update( 5 );
+  system.update( 2 );
+
+  const std::vector< float >& values( snapshots.acquire_latest() );
+  ASSERT_LT( slot, values.size() );
+  EXPECT_FLOAT_EQ( 70, values[ slot ] );
+
+  system.publish_outputs( nullptr );
+  system.update( 1 );
+  EXPECT_FLOAT_EQ( 70, snapshots.acquire_latest()[ slot ] );
+}
+
+TEST( triple_buffer, bound_outputs_only )
+{
+  tweeners::system system;
+  tweeners::system::output_snapshots snapshots;
+  int values[ 10 ];
+
+  system.publish_outputs( &snapshots );
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, &tweeners::easing::linear< float > )
+      .build( system ) );
+
+  for ( int& value : values )
+    tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .build( system );
+
+  system.update( 5 );
+
+  // The slots without output have no storage in the buffer of the system and
+  // are not copied in the snapshots.
+  const std::vector< float >& published( snapshots.acquire_latest() );
+  EXPECT_EQ( slot + 1, system.output_values().size() );
+  ASSERT_EQ( slot + 1, published.size() );
+  EXPECT_FLOAT_EQ( 50, published[ slot ] );
+}
@@ -0,0 +1,201 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/command_buffer.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  using entry_vector = std::vector< std::pair< std::size_t, float > >;
+
+  tweeners::system::group_function
+  collect( std::vector< entry_vector >& calls )
+  {
+    return
+      [ &calls ]( tweeners::span< const tweeners::system::group_entry > e )
+      -> void
+      {
+        entry_vector entries;
+
+        for ( const tweeners::system::group_entry& entry : e )
+          entries.emplace_back( entry.key, entry.value );
+
+        std::sort( entries.begin(), entries.end() );
+        calls.push_back( entries );
+      };
+  }
+}
+
+TEST( update_group, one_call_per_update )
+{
+  tweeners::system system;
+  std::vector< entry_vector > calls;
+
+  const tweeners::update_group group
+    ( system.register_update_group( collect( calls ) ) );
+
+  for ( std::size_t i( 0 ); i != 3; ++i )
+    tweeners::builder()
+      .range_transform( 0, 10 * i, 10, &tweeners::easing::linear< float > )
+      .in_group( group, 100 + i )
+      .build( system );
+
+  system.update( 5 );
+
+  ASSERT_EQ( 1, calls.size() );
+  EXPECT_EQ
+    ( entry_vector( { { 100, 0 }, { 101, 5 }, { 102, 10 } } ), calls[ 0 ] );
+
+  system.update( 5 );
+
+  ASSERT_EQ( 2, calls.size() );
+  EXPECT_EQ
+    ( entry_vector( { { 100, 0 }, { 101, 10 }, { 102, 20 } } ), calls[ 1 ] );
+
+  // Nothing is running, the group is not called.
+  system.update( 5 );
+  EXPECT_EQ( 2, calls.size() );
+}
+
+TEST( update_group, slot_as_key )
+{
+  tweeners::system system;
+  std::vector< entry_vector > calls;
+
+  const tweeners::update_group group
+    ( system.register_update_group( collect( calls ) ) );
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 1, 10, &tweeners::easing::linear< float > )
+      .in_group( group )
+      .build( system ) );
+
+  system.update( 5 );
+
+  ASSERT_EQ( 1, calls.size() );
+  EXPECT_EQ( entry_vector( { { slot, 0.5 } } ), calls[ 0 ] );
+}
+
+TEST( update_group, before_done )
+{
+  tweeners::system system;
+  float value( -1 );
+  bool done_after_value( false );
+
+  const tweeners::update_group group
+    ( system.register_update_group
+      ( [ &value ]
+        ( tweeners::span< const tweeners::system::group_entry > entries )
+        -> void
+        {
+          value = entries[ 0 ].value;
+        } ) );
+
+  tweeners::builder()
+    .range_transform( 0, 1, 10, &tweeners::easing::linear< float > )
+    .in_group( group )
+    .on_done
+    ( [ &value, &done_after_value ]() -> void
+      {
+        done_after_value = ( value == 1 );
+      } )
+    .build( system );
+
+  system.update( 10 );
+  EXPECT_TRUE( done_after_value );
+}
+
+TEST( update_group, sequence )
+{
+  tweeners::system system;
+  std::vector< entry_vector > calls;
+
+  const tweeners::update_group group
+    ( system.register_update_group( collect( calls ) ) );
+
+  const tweeners::system::id_type first
+    ( tweeners::builder()
+      .range_transform( 0, 10, 10, &tweeners::easing::linear< float > )
+      .in_group( group, 1 )
+      .build( system ) );
+  const tweeners::system::id_type second
+    ( tweeners::builder()
+      .range_transform( 0, 20, 0, &tweeners::easing::linear< float > )
+      .in_group( group, 2 )
+      .after( first )
+      .build( system ) );
+  tweeners::builder()
+    .range_transform( 0, 30, 10, &tweeners::easing::linear< float > )
+    .in_group( group, 3 )
+    .after( second )
+    .build( system );
+
+  // The successors are updated in a pass of their own, after the completion
+  // of their predecessor, each pass calling the group.
+  system.update( 15 );
+
+  ASSERT_EQ( 3, calls.size() );
+  EXPECT_EQ( entry_vector( { { 1, 10 } } ), calls[ 0 ] );
+  EXPECT_EQ( entry_vector( { { 2, 20 } } ), calls[ 1 ] );
+  EXPECT_EQ( entry_vector( { { 3, 15 } } ), calls[ 2 ] );
+
+  system.update( 5 );
+
+  ASSERT_EQ( 4, calls.size() );
+  EXPECT_EQ( entry_vector( { { 3, 30 } } ), calls[ 3 ] );
+}
+
+TEST( update_group, several_groups )
+{
+  tweeners::system system;
+  std::vector< entry_vector > calls_1;
+  std::vector< entry_vector > calls_2;
+
+  const tweeners::update_group group_1
+    ( system.register_update_group( collect( calls_1 ) ) );
+  const tweeners::update_group group_2
+    ( system.register_update_group( collect( calls_2 ) ) );
+
+  {
+    tweeners::command_buffer commands( system );
+
+    tweeners::builder()
+      .range_transform( 0, 10, 10, &tweeners::easing::linear< float > )
+      .in_group( group_1, 1 )
+      .build( commands );
+    tweeners::builder()
+      .range_transform( 0, 20, 10, &tweeners::easing::linear< float > )
+      .in_group( group_2, 2 )
+      .build( commands );
+  }
+
+  system.update( 5 );
+
+  ASSERT_EQ( 1, calls_1.size() );
+  EXPECT_EQ( entry_vector( { { 1, 5 } } ), calls_1[ 0 ] );
+  ASSERT_EQ( 1, calls_2.size() );
+  EXPECT_EQ( entry_vector( { { 2, 10 } } ), calls_2[ 0 ] );
+}
+
+TEST( update_group, invalid )
+{
+  tweeners::system system;
+
+  const tweeners::system::id_type slot
+    ( system.configure_slot
+      ( 10, []( float ) -> void {}, &tweeners::easing::linear< float > ) );
+
+  EXPECT_THROW
+    ( system.bind_group( slot, 0, 1, tweeners::update_group() ),
+      std::runtime_error );
+  EXPECT_THROW
+    ( system.register_update_group( tweeners::system::group_function() ),
+      std::runtime_error );
+}
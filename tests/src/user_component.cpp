@@ -0,0 +1,143 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+TEST( system, user_component_default )
+{
+  int value;
+
+  tweeners::system system;
+  const tweeners::component< std::string > name
+    ( system.register_component< std::string >( "none" ) );
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .build( system ) );
+
+  EXPECT_FALSE( system.has_component( name, slot ) );
+  EXPECT_EQ( "none", system.get_component( name, slot ) );
+
+  system.set_component( name, slot, "slot" );
+
+  EXPECT_TRUE( system.has_component( name, slot ) );
+  EXPECT_EQ( "slot", system.get_component( name, slot ) );
+}
+
+TEST( system, user_component_registered_after_slots )
+{
+  int value;
+
+  tweeners::system system;
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .build( system ) );
+
+  const tweeners::component< int > c( system.register_component< int >( -1 ) );
+
+  EXPECT_EQ( -1, system.get_component( c, slot ) );
+
+  system.set_component( c, slot, 24 );
+  EXPECT_EQ( 24, system.get_component( c, slot ) );
+}
+
+TEST( system, user_component_span )
+{
+  int value;
+
+  tweeners::system system;
+  const tweeners::component< int > c( system.register_component< int >() );
+
+  std::vector< tweeners::system::id_type > slots;
+
+  for ( int i( 0 ); i != 10; ++i )
+    slots.push_back
+      ( tweeners::builder()
+        .range_transform
+        ( 0, 100, 10, value, &tweeners::easing::linear< float > )
+        .build( system ) );
+
+  for ( int i( 0 ); i < 10; i += 3 )
+    system.set_component( c, slots[ i ], i );
+
+  const tweeners::span< int > values( system.component_values( c ) );
+  const tweeners::span< const tweeners::system::id_type > component_slots
+    ( system.component_slots( c ) );
+
+  ASSERT_EQ( 4u, values.size() );
+  ASSERT_EQ( 4u, component_slots.size() );
+
+  for ( std::size_t i( 0 ); i != values.size(); ++i )
+    {
+      EXPECT_EQ( slots[ values[ i ] ], component_slots[ i ] );
+      values[ i ] *= 2;
+    }
+
+  EXPECT_EQ( 12, system.get_component( c, slots[ 6 ] ) );
+}
+
+TEST( system, user_component_removed_with_slot )
+{
+  int value;
+
+  tweeners::system system;
+  const tweeners::component< int > c( system.register_component< int >() );
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .build( system ) );
+
+  system.set_component( c, slot, 42 );
+  system.remove_slot( slot );
+  system.update( 1 );
+
+  EXPECT_TRUE( system.component_values( c ).empty() );
+
+  // The identifier is recycled, the component must be back to its default.
+  const tweeners::system::id_type new_slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .build( system ) );
+
+  EXPECT_EQ( slot, new_slot );
+  EXPECT_FALSE( system.has_component( c, new_slot ) );
+  EXPECT_EQ( 0, system.get_component( c, new_slot ) );
+}
+
+TEST( system, user_component_wrong_handle )
+{
+  tweeners::system system;
+  system.register_component< int >();
+
+  const tweeners::component< float > c;
+
+  EXPECT_THROW( system.component_values( c ), std::runtime_error );
+}
+
+TEST( system, user_component_copy )
+{
+  int value;
+
+  tweeners::system system;
+  const tweeners::component< int > c( system.register_component< int >() );
+
+  const tweeners::system::id_type slot
+    ( tweeners::builder()
+      .range_transform( 0, 100, 10, value, &tweeners::easing::linear< float > )
+      .build( system ) );
+
+  system.set_component( c, slot, 42 );
+
+  tweeners::system copy( system );
+  copy.set_component( c, slot, 24 );
+
+  EXPECT_EQ( 42, system.get_component( c, slot ) );
+  EXPECT_EQ( 24, copy.get_component( c, slot ) );
+}
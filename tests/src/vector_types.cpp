@@ -0,0 +1,126 @@
+#include "tweeners/builder.hpp"
+#include "tweeners/easing.hpp"
+#include "tweeners/system.hpp"
+#include "tweeners/vector_types.hpp"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST( vector_types, vec2 )
+{
+  tweeners::system system;
+  tweeners::vec2<> value{ -1, -1 };
+
+  tweeners::builder()
+    .range_transform
+    ( tweeners::vec2<>{ 0, 100 }, tweeners::vec2<>{ 100, 0 }, 10, value,
+      &tweeners::easing::linear< float > )
+    .build( system );
+
+  system.update( 1 );
+  EXPECT_FLOAT_EQ( 10, value.x );
+  EXPECT_FLOAT_EQ( 90, value.y );
+
+  system.update( 9 );
+  EXPECT_FLOAT_EQ( 100, value.x );
+  EXPECT_FLOAT_EQ( 0, value.y );
+}
+
+TEST( vector_types, vec3_vec4 )
+{
+  tweeners::system system;
+  tweeners::vec3<> position{ -1, -1, -1 };
+  tweeners::vec4< double > color{ -1, -1, -1, -1 };
+
+  tweeners::builder()
+    .range_transform
+    ( tweeners::vec3<>{ 0, 10, 20 }, tweeners::vec3<>{ 40, 30, 20 }, 10,
+      position, &tweeners::easing::quad< float > )
+    .build( system );
+
+  tweeners::builder()
+    .range_transform
+    ( tweeners::vec4< double >{ 0, 0, 0, 1 },
+      tweeners::vec4< double >{ 1, 0.5, 0.25, 0 }, 10, color,
+      &tweeners::easing::linear< float > )
+    .build( system );
+
+  system.update( 5 );
+
+  EXPECT_FLOAT_EQ( 10, position.x );
+  EXPECT_FLOAT_EQ( 15, position.y );
+  EXPECT_FLOAT_EQ( 20, position.z );
+
+  EXPECT_DOUBLE_EQ( 0.5, color.x );
+  EXPECT_DOUBLE_EQ( 0.25, color.y );
+  EXPECT_DOUBLE_EQ( 0.125, color.z );
+  EXPECT_DOUBLE_EQ( 0.5, color.w );
+}
+
+TEST( vector_types, rgba8 )
+{
+  tweeners::system system;
+  tweeners::rgba8 color{ 0, 0, 0, 0 };
+
+  tweeners::builder()
+    .range_transform
+    ( tweeners::rgba8{ 0, 255, 10, 255 }, tweeners::rgba8{ 255, 0, 20, 0 },
+      10, color, &tweeners::easing::linear< float > )
+    .build( system );
+
+  system.update( 3 );
+
+  EXPECT_EQ( 77, color.r );
+  EXPECT_EQ( 179, color.g );
+  EXPECT_EQ( 13, color.b );
+  EXPECT_EQ( 179, color.a );
+
+  system.update( 7 );
+
+  EXPECT_EQ( 255, color.r );
+  EXPECT_EQ( 0, color.g );
+  EXPECT_EQ( 20, color.b );
+  EXPECT_EQ( 0, color.a );
+}
+
+TEST( vector_types, rgba8_saturation )
+{
+  tweeners::system system;
+  std::vector< tweeners::rgba8 > colors;
+
+  // The back easing goes below zero at the beginning, thus the channels go
+  // past their bounds.
+  tweeners::builder()
+    .range_transform
+    ( tweeners::rgba8{ 0, 255, 0, 0 }, tweeners::rgba8{ 255, 0, 0, 0 }, 10,
+      [ &colors ]( tweeners::rgba8 c ) -> void { colors.push_back( c ); },
+      &tweeners::easing::back< float > )
+    .build( system );
+
+  system.update( 2 );
+  system.update( 8 );
+
+  ASSERT_EQ( 2, colors.size() );
+  EXPECT_EQ( 0, colors[ 0 ].r );
+  EXPECT_EQ( 255, colors[ 0 ].g );
+  EXPECT_EQ( 255, colors[ 1 ].r );
+  EXPECT_EQ( 0, colors[ 1 ].g );
+}
+
+TEST( vector_types, integral_callback )
+{
+  tweeners::system system;
+  float value( -1 );
+
+  // The values passed to the callback are not truncated to the type of the
+  // bounds.
+  tweeners::builder()
+    .range_transform
+    ( 0, 1, 10, [ &value ]( float v ) -> void { value = v; },
+      &tweeners::easing::linear< float > )
+    .build( system );
+
+  system.update( 5 );
+  EXPECT_FLOAT_EQ( 0.5, value );
+}
@@ -46,3 +46,57 @@ TEST( system, zero_duration_in_sequence )
   system.update( 1 );
   EXPECT_EQ( 4, value_3 );
 }
+
+TEST( system, zero_duration_passes )
+{
+  int value_1( -1 );
+  int value_2( -1 );
+  int value_3( -1 );
+  int value_4( -1 );
+  int done_count( 0 );
+  tweeners::system system;
+
+  const auto count_done( [ &done_count ]() -> void { ++done_count; } );
+
+  const int slot_1
+    ( tweeners::builder()
+      .range_transform
+      ( 0, 100, 10, value_1, &tweeners::easing::linear< float > )
+      .on_done( count_done )
+      .build( system ) );
+
+  // Each successor is started in its own pass of the update, with the time
+  // left by its predecessor.
+  const int slot_2
+    ( tweeners::builder()
+      .range_transform( 0, 10, 0, value_2, &tweeners::easing::linear< float > )
+      .on_done( count_done )
+      .after( slot_1 )
+      .build( system ) );
+
+  const int slot_3
+    ( tweeners::builder()
+      .range_transform( 0, 20, 0, value_3, &tweeners::easing::linear< float > )
+      .on_done( count_done )
+      .after( slot_2 )
+      .build( system ) );
+
+  tweeners::builder()
+    .range_transform( 0, 100, 10, value_4, &tweeners::easing::linear< float > )
+    .on_done( count_done )
+    .after( slot_3 )
+    .build( system );
+
+  system.update( 15 );
+  EXPECT_EQ( 100, value_1 );
+  EXPECT_EQ( 10, value_2 );
+  EXPECT_EQ( 20, value_3 );
+  EXPECT_EQ( 50, value_4 );
+  EXPECT_EQ( 3, done_count );
+  EXPECT_EQ( 1, system.running_count() );
+
+  system.update( 5 );
+  EXPECT_EQ( 100, value_4 );
+  EXPECT_EQ( 4, done_count );
+  EXPECT_EQ( 0, system.running_count() );
+}